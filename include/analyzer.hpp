@@ -0,0 +1,24 @@
+#pragma once
+#include <ostream>
+#include <string>
+#include <vector>
+#include "assembler.hpp"
+
+// Static performance model for assembled code (`rae --analyze`). Works purely
+// from the listing: no hardware counters, no execution. The code is assumed to
+// be loaded at a 64-byte aligned address and inner forward branches of a loop
+// are assumed not taken.
+//
+// Per basic block: size, fused-domain uops and the register/flags dependency
+// critical path. Per loop (a backward branch and the code from its target up
+// to it): estimated cycles per iteration as the max of the loop-carried
+// dependency recurrence, port pressure, front-end issue width and taken
+// branches. XMMn and YMMn count as one register. Warnings: branches crossing
+// a cache line, branches hit by the Skylake JCC erratum, uop-cache windows
+// holding too many uops, and instruction forms the model doesn't cover.
+
+// names accepted by analyzeListing
+std::vector<std::string> analyzerMicroarchs();
+
+// Writes the report to `out`. Throws std::runtime_error for an unknown march.
+void analyzeListing(const std::vector<ListingEntry>& listing, const std::string& march, std::ostream& out);
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include "encoder.hpp"
+#include "encode_cache.hpp"
+
+class WorkStealingPool;
+struct Profile;
+
+// One encoded instruction, kept when Assembler::keepListing is set.
+struct ListingEntry {
+    ParsedInstruction instr;
+    uint64_t address = 0;
+    uint64_t size = 0;
+};
+
+// Result of assembling one source unit. On failure `errors` holds one entry per
+// problem found ("line N: message") and `bytes` must not be used.
+struct AssemblyResult {
+    bool ok = true;
+    std::vector<uint8_t> bytes;
+    std::unordered_map<std::string,uint64_t> labels;
+    std::vector<std::string> errors;
+    EncodingCache::Stats cacheStats;
+    std::vector<ListingEntry> listing; // in output order, including label-only lines
+};
+
+// Two-pass assembler for a whole unit: parse, lay out (label addresses), encode.
+// Holds only a const reference to the encoder, so a single encoder and assembler
+// can be shared by any number of threads.
+class Assembler {
+public:
+    explicit Assembler(const InstructionEncoder& encoder);
+
+    // When a pool is given and the source is larger than splitBytes, the unit is
+    // cut at line boundaries and every pass runs on the chunks in parallel.
+    // `trace` gets the per-instruction pass-2 log and forces a serial run.
+    AssemblyResult assemble(const std::string& src, WorkStealingPool* pool = nullptr, std::ostream* trace = nullptr) const;
+
+    // Same, reusing the buffers already in `res` (cleared first, capacity kept).
+    // A non-null `cache` replaces the per-chunk caches and keeps its entries for
+    // the next call; the unit then runs serially since the cache is single-threaded.
+    void assemble(const std::string& src, AssemblyResult& res, EncodingCache* cache,
+                  WorkStealingPool* pool = nullptr, std::ostream* trace = nullptr) const;
+
+    // fallback size for instructions that fail to encode in pass 1 (the error is reported in pass 2)
+    static uint64_t estimateSize(const std::string& mnemonic);
+
+    size_t splitBytes = 256 * 1024;
+    // when set, basic blocks are reordered by this profile before layout (see profile.hpp)
+    const Profile* profile = nullptr;
+    // memoize encodings of repeated instruction forms (see encode_cache.hpp).
+    // Off by default: a lookup costs about as much as encoding these forms.
+    bool useCache = false;
+    // time cache hits/misses so cacheStats can estimate the speedup
+    bool timeCache = false;
+    // fill AssemblyResult::listing (used by the analyzer)
+    bool keepListing = false;
+
+private:
+    const InstructionEncoder& encoder;
+};
+
+bool readFile(const std::string& path, std::string& out);
+bool writeFile(const std::string& path, const std::vector<uint8_t>& bytes);
@@ -0,0 +1,25 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <ostream>
+
+// One unit of a batch run: assemble `input` and write the bytes to `output`.
+struct BatchJob {
+    std::string input;
+    std::string output;
+};
+
+// Manifest format: one "input output" pair per line; blank lines and lines
+// starting with '#' are ignored. Throws std::runtime_error on malformed lines.
+std::vector<BatchJob> readManifest(const std::string& path);
+
+struct BatchOptions {
+    unsigned threads = 1;
+    bool useCache = false; // per-unit encoding cache
+    bool stats = false;    // report aggregated cache hit rate and estimated speedup
+};
+
+// Assembles all jobs on a work-stealing pool of `threads` workers, sharing one
+// encoder. A failing unit is reported to `log` and does not stop the others.
+// Returns the number of failed units.
+size_t runBatch(const std::vector<BatchJob>& jobs, const BatchOptions& opts, std::ostream& log);
@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <ostream>
+#include "protocol.hpp"
+
+// Client side of the `rae --serve` protocol. One connection, requests are sent
+// one at a time; the constructor and assemble() throw std::runtime_error on
+// connection or protocol errors.
+class AssemblerClient {
+public:
+    explicit AssemblerClient(const std::string& socketPath);
+    ~AssemblerClient();
+
+    AssemblerClient(const AssemblerClient&) = delete;
+    AssemblerClient& operator=(const AssemblerClient&) = delete;
+
+    rae_proto::Response assemble(const rae_proto::Request& req);
+
+private:
+    int fd = -1;
+    std::vector<uint8_t> buf;
+};
+
+// Load generator: `connections` clients each send `requests` copies of `source`
+// back to back, then the request latency percentiles are written to `out`.
+// Returns the number of failed requests.
+size_t runLoadGenerator(const std::string& socketPath, const std::string& source,
+                        unsigned connections, size_t requests, std::ostream& out);
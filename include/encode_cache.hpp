@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "encoder.hpp"
+
+// Memoizes InstructionEncoder results for one unit (or one chunk of it).
+// The key is the normalized instruction form: mnemonic plus operand kinds,
+// registers, immediates and memory components. Label names are left out of
+// the key, so `JMP a` and `JMP b` share an entry: the cached bytes are a
+// template whose rel32/disp32 field is re-patched for each use.
+// Not thread-safe; give each worker its own cache.
+class EncodingCache {
+public:
+    struct Counts {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t lookups() const { return hits + misses; }
+        double hitRate() const;
+    };
+
+    struct Stats {
+        // Counted per pass: pass 2 looks up the forms pass 1 just inserted, so
+        // a combined rate would count every instruction as at least one hit.
+        Counts size;   // pass 1, instructionSize
+        Counts encode; // pass 2, encodeInstruction
+        uint64_t hitNanos = 0;  // only filled when timing is enabled
+        uint64_t missNanos = 0;
+        // every sampleEvery-th lookup also times the plain encoder call an
+        // uncached run would make (not counted in hitNanos/missNanos)
+        uint64_t samples = 0;
+        uint64_t sampleNanos = 0;
+
+        void merge(const Stats& o);
+        // removes an earlier snapshot of the same cache
+        void subtract(const Stats& o);
+        uint64_t lookups() const { return size.lookups() + encode.lookups(); }
+        // time an uncached run would have taken (every lookup at the sampled
+        // encoder cost) divided by the time actually spent; 0 without samples
+        double estimatedSpeedup() const;
+        // "Cache: pass 1 H/L hits (X%), pass 2 H/L hits (Y%)[, est. speedup Zx]"
+        void print(std::ostream& os, bool withSpeedup) const;
+    };
+
+    explicit EncodingCache(const InstructionEncoder& encoder, bool timed = false);
+
+    // pass 1: size without label addresses
+    size_t instructionSize(const ParsedInstruction& instr);
+    // pass 2: appends the same bytes InstructionEncoder::encodeInstruction
+    // returns (or throws its error) to `out`; returns the number appended
+    size_t encodeInstruction(const ParsedInstruction& instr, const std::unordered_map<std::string,uint64_t>& labels,
+                             uint64_t currentAddress, std::vector<uint8_t>& out);
+
+    const Stats& stats() const { return st; }
+    size_t size() const { return entries.size(); }
+    // drops all entries (stats are kept)
+    void clear() { entries.clear(); }
+
+private:
+    struct Entry {
+        std::vector<uint8_t> bytes;
+        int relOffset = -1;
+    };
+
+    static constexpr uint64_t sampleEvery = 64;
+
+    const InstructionEncoder& encoder;
+    bool timed;
+    Stats st;
+    std::unordered_map<std::string, Entry> entries;
+    // reused to avoid allocations per lookup and per miss
+    std::string key;
+    std::unordered_map<std::string,uint64_t> placeholders;
+
+    const Entry& lookup(const ParsedInstruction& instr, Counts& counts);
+    template <class F> void sample(F&& uncached);
+};
@@ -8,32 +8,71 @@
 // Final encoded output chunk per instruction
 struct Encoded {
     std::vector<uint8_t> bytes;
+    int relOffset = -1; // offset of the label-relative rel32/disp32 field, -1 if none
 };
 
 class InstructionEncoder {
 public:
     InstructionEncoder();
     // encode one parsed instruction (needs label address resolution externally for rel32)
-    Encoded encodeInstruction(const ParsedInstruction& instr, const std::unordered_map<std::string,uint64_t>& labelAddrs, uint64_t currentAddress);
+    Encoded encodeInstruction(const ParsedInstruction& instr, const std::unordered_map<std::string,uint64_t>& labelAddrs, uint64_t currentAddress) const;
+
+    // size of the encoding without knowing label addresses (layout pass 1);
+    // valid because every label-relative field here is a fixed-size rel32/disp32
+    size_t instructionSize(const ParsedInstruction& instr) const;
 
     // helper to write little-endian
     static void writeLE(std::vector<uint8_t>& out, uint64_t value, size_t bytes);
 private:
-    // register maps
+    // SSE/AVX instruction forms, looked up by mnemonic in vecOps
+    struct VecOp {
+        enum Form {
+            MOVE,  // x, x/m | m, x (store uses storeOpcode)
+            RM,    // SSE two-operand: x, x/m
+            RVM,   // VEX three-operand: x, x, x/m
+            MASK,  // r64, x
+            BCAST, // x/y, xmm/m
+        } form;
+        bool vex;
+        uint8_t pp;          // implied prefix: 0 none, 1 66, 2 F3, 3 F2
+        uint8_t map;         // opcode map: 1 0F, 2 0F38, 3 0F3A
+        uint8_t opcode;
+        uint8_t storeOpcode; // MOVE only
+        bool w;              // VEX.W
+        bool ymmOnly;        // VEX.256 only (VBROADCASTSD)
+    };
+
+    // register maps (read-only after construction, so one encoder can be shared across threads)
     std::unordered_map<std::string, uint8_t> reg64;
+    std::unordered_map<std::string, uint8_t> vecReg; // XMM0-15 and YMM0-15
+    std::unordered_map<std::string, VecOp> vecOps;
 
     // helpers to form REX, ModRM, SIB, etc.
-    uint8_t rex(bool w, bool r, bool x, bool b);
-    uint8_t modrm(uint8_t mod, uint8_t reg, uint8_t rm);
-    uint8_t sib(uint8_t scale, uint8_t index, uint8_t base);
+    uint8_t rex(bool w, bool r, bool x, bool b) const;
+    uint8_t modrm(uint8_t mod, uint8_t reg, uint8_t rm) const;
+    uint8_t sib(uint8_t scale, uint8_t index, uint8_t base) const;
+
+    // memory operand helpers (ModRM/SIB/disp, RIP-relative fixups). resolveMem
+    // checks the registers and gives the REX/VEX X and B bits for the prefix,
+    // emitMemModRM then writes everything after the opcode.
+    struct MemRef {
+        uint8_t base = 5, index = 4, scaleBits = 0;
+        bool hasBase = false, hasIndex = false, ripRel = false;
+    };
+    MemRef resolveMem(const ParsedOperand& mem) const;
+    void emitMemModRM(Encoded& out, uint8_t reg, const MemRef& ref, const ParsedOperand& mem, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, size_t immBytes) const;
+    void encodeMemOp(Encoded& out, uint8_t opcode, uint8_t reg, const ParsedOperand& mem, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, size_t immBytes) const;
+    bool encodeALUMem(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, uint8_t opLoad, uint8_t opStore, uint8_t ext) const;
 
     // encoding helpers
-    void encodeMOV(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr);
-    void encodeADD(const ParsedInstruction& instr, Encoded& out);
-    void encodeSUB(const ParsedInstruction& instr, Encoded& out);
-    void encodeJMP(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr);
-    void encodeCMP(const ParsedInstruction& instr, Encoded& out);
-    void encodeJE(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr);
-    void encodeCALL(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr);
-    void encodeRET(const ParsedInstruction& instr, Encoded& out);
+    void encodeMOV(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const;
+    void encodeADD(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const;
+    void encodeSUB(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const;
+    void encodeJMP(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const;
+    void encodeCMP(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const;
+    void encodeJcc(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, uint8_t cc) const;
+    void encodeCALL(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const;
+    void encodeRET(const ParsedInstruction& instr, Encoded& out) const;
+    void vexPrefix(Encoded& out, bool r, bool x, bool b, uint8_t map, bool w, uint8_t vvvv, bool l, uint8_t pp) const;
+    void encodeVector(const ParsedInstruction& instr, const VecOp& op, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const;
 };
\ No newline at end of file
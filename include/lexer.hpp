@@ -5,16 +5,19 @@
 
 class Lexer {
 public:
-    explicit Lexer(const std::string& src);
+    // firstLine lets a lexer over a slice of a larger file report file-relative lines
+    explicit Lexer(const std::string& src, size_t firstLine = 1);
     Token nextToken();
 
 private:
     std::string src;
     size_t pos = 0;
+    size_t line = 1;
 
     char peek() const;
     char get();
     void skipSpaces();
     Token identifierOrRegister();
     Token numberToken();
+    Token scanToken();
 };
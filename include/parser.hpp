@@ -9,10 +9,11 @@
 
 struct ParsedOperand {
     enum Kind { REG, IMM, MEM, LABEL } kind;
-    std::string text; // register name, immediate text, or label name
+    std::string text; // register name (GPR, XMM0-15, YMM0-15), immediate text, or label name
     // For memory operands we store components
     std::optional<std::string> base;   // base register
     std::optional<std::string> index;  // index register
+    std::optional<std::string> symbol; // label in [label + disp] / [RIP + label], addressed RIP-relative
     int scale = 1;
     int64_t disp = 0;
 };
@@ -24,16 +25,26 @@ struct ParsedInstruction {
     size_t sourceLine = 0;
 };
 
+// Single pass over the tokens: every loop consumes a token or stops at the end
+// of the line, so parsing is linear in the input. A malformed line is reported
+// in errors() and skipped; parsing stops after maxErrors diagnostics.
 class Parser {
 public:
     explicit Parser(Lexer& lex);
     std::vector<ParsedInstruction> parseAll();
 
+    // "line N: message" for every line that failed to parse
+    const std::vector<std::string>& errors() const { return diags; }
+    size_t maxErrors = 100;
+
 private:
     Lexer& lexer;
     Token cur;
     void next();
     ParsedInstruction parseLine();
     ParsedOperand parseOperand();
+    void parseScale(ParsedOperand& op);
+    void syncToEOL();
+    std::vector<std::string> diags;
     int64_t parseNumberText(const std::string& s);
 };
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "parser.hpp"
+
+// Execution profile for profile-guided block layout. File format, one entry
+// per line ('#' starts a comment, label names are case-insensitive):
+//   LABEL COUNT          block execution count
+//   FROM -> TO COUNT     optional edge count between two labeled blocks
+struct Profile {
+    std::unordered_map<std::string,uint64_t> blockCounts;
+    std::unordered_map<std::string,std::unordered_map<std::string,uint64_t>> edgeCounts;
+};
+
+// Throws std::runtime_error on unreadable files or malformed lines.
+Profile readProfile(const std::string& path);
+
+struct ReorderStats {
+    size_t blocks = 0;
+    size_t coldBlocks = 0;       // moved behind all hot blocks
+    size_t invertedBranches = 0; // JE<->JNE so the hot successor falls through
+    size_t addedJumps = 0;       // JMPs inserted where a fallthrough was broken
+    size_t removedJumps = 0;     // JMPs to the block that now follows directly
+};
+
+// Splits `instrs` into basic blocks (at labels and after JMP/JE/JNE/RET), lays
+// them out so hot successors fall through, moves cold (zero-count) blocks to the
+// end and rewrites branches to keep the program equivalent. The first block
+// stays first; a last block that falls off the end stays last.
+std::vector<ParsedInstruction> reorderBlocks(const std::vector<ParsedInstruction>& instrs, const Profile& profile, ReorderStats* stats = nullptr);
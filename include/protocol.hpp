@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Wire format shared by `rae --serve` and its clients. Every message is a frame:
+//   u32 length (little-endian) | payload[length]
+//
+// Request payload:
+//   u32 flags | u64 baseAddress | source bytes (rest of the frame)
+// Response payload:
+//   u8 status (0 ok, 1 failed)
+//   u32 nbytes  | bytes
+//   u32 nsyms   | { u32 nameLen | name | u64 addr } * nsyms
+//   u32 ndiags  | { u32 len | text } * ndiags
+namespace rae_proto {
+
+constexpr uint32_t MAX_FRAME = 64u * 1024 * 1024;
+
+enum RequestFlags : uint32_t {
+    WANT_SYMBOLS = 1u << 0,
+};
+
+struct Request {
+    uint32_t flags = WANT_SYMBOLS;
+    uint64_t baseAddress = 0; // added to reported symbol addresses
+    std::string source;
+};
+
+struct Response {
+    bool ok = false;
+    std::vector<uint8_t> bytes;
+    std::vector<std::pair<std::string,uint64_t>> symbols;
+    std::vector<std::string> diagnostics;
+};
+
+void encodeRequest(const Request& req, std::vector<uint8_t>& out);
+void encodeResponse(const Response& resp, std::vector<uint8_t>& out);
+// decoders throw std::runtime_error on truncated or malformed payloads
+void decodeRequest(const std::vector<uint8_t>& payload, Request& req);
+void decodeResponse(const std::vector<uint8_t>& payload, Response& resp);
+
+// Blocking frame I/O on a stream socket. readFrame returns false on a clean EOF
+// before the header; both throw std::runtime_error on I/O errors or oversized frames.
+bool readFrame(int fd, std::vector<uint8_t>& payload);
+void writeFrame(int fd, const std::vector<uint8_t>& payload);
+
+} // namespace rae_proto
@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool. Each worker owns a deque: it pushes and pops at the
+// back (LIFO, cache friendly), idle workers steal from the front of others.
+// Tasks submitted from outside the pool go through a shared FIFO instead.
+// Tasks may submit further tasks; parallelFor() helps run queued work while it
+// waits, so nesting it inside a task cannot deadlock the pool.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(unsigned threads = std::thread::hardware_concurrency());
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // tasks passed to submit() must not throw
+    void submit(std::function<void()> task);
+    // run fn(0..n-1) on the pool and block until all have finished;
+    // the first exception thrown by fn is rethrown here
+    void parallelFor(size_t n, const std::function<void(size_t)>& fn);
+    // block until every submitted task has finished
+    void waitIdle();
+
+    unsigned size() const { return (unsigned)workers.size(); }
+
+private:
+    struct Queue {
+        std::mutex m;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues; // one per worker
+    Queue injected;                              // tasks submitted from outside the pool
+    std::vector<std::thread> workers;
+    std::atomic<size_t> pending{0};   // submitted but not yet finished
+    std::atomic<size_t> queued{0};    // sitting in a deque
+    std::atomic<bool> stopping{false};
+    std::mutex sleepMutex;
+    std::condition_variable sleepCv;
+    std::condition_variable idleCv;
+
+    int currentWorker() const;
+    bool tryRunOne(int self);
+    void workerLoop(unsigned idx);
+};
@@ -0,0 +1,12 @@
+#pragma once
+#include <string>
+#include <ostream>
+
+// `rae --serve`: listen on a Unix domain socket and answer framed assemble
+// requests (see protocol.hpp) until SIGINT/SIGTERM. Idle connections are
+// watched by a single poll loop; each ready request is handed to a
+// work-stealing pool, so many connections share `threads` workers. The encoder
+// is shared; each worker keeps its frame buffers and assembly result (and, with
+// `useCache`, an encoding cache) warm between requests. Parsing and layout
+// still allocate per request. Returns a process exit code.
+int runServer(const std::string& socketPath, unsigned threads, bool useCache, std::ostream& log);
@@ -0,0 +1,555 @@
+#include "analyzer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+
+using PortMask = uint32_t;
+constexpr PortMask P(int i) { return 1u << i; }
+
+// Per-microarchitecture numbers for the instruction forms rae can emit.
+// Approximations after Agner Fog's tables and uops.info.
+struct UArch {
+    const char* name;
+    int ports;
+    const char* portNames[12];
+    double issueWidth;        // fused-domain uops per cycle
+    double aluLat, loadLat;   // load latency is load-to-use
+    bool moveElim;            // reg-reg MOV handled at rename (no port, no latency)
+    bool fuseAluJcc;          // ADD/SUB + Jcc macro-fuse (CMP + Jcc always does)
+    PortMask alu, load, storeAddr, storeData, branch, takenBranch;
+    // SSE/AVX: integer ALU, shuffle (broadcast from a register), PMOVMSKB, FMA, store data
+    PortMask vecAlu, vecShuffle, vecMask, fma, vecStoreData;
+    double vecLoadLat, shuffleLat, maskLat, fmaLat;
+    unsigned lineBytes;
+    unsigned dsbWindowBytes;  // 0: no uop-cache window check
+    unsigned dsbSlotsPerWindow;
+    bool jccErratum;          // jumps touching a 32-byte boundary are not DSB cached
+};
+
+const UArch uarchs[] = {
+    { "skylake", 8, { "p0","p1","p2","p3","p4","p5","p6","p7" }, 4, 1, 5, true, true,
+      P(0)|P(1)|P(5)|P(6), P(2)|P(3), P(2)|P(3)|P(7), P(4), P(0)|P(6), P(6),
+      P(0)|P(1)|P(5), P(5), P(0), P(0)|P(1), P(4),
+      7, 3, 2, 4,
+      64, 32, 18, true },
+    { "zen2", 12, { "alu0","alu1","alu2","alu3","agu0","agu1","agu2","std","fp0","fp1","fp2","fp3" }, 5, 1, 4, true, false,
+      P(0)|P(1)|P(2)|P(3), P(4)|P(5), P(4)|P(5)|P(6), P(7), P(0)|P(3), P(0)|P(3),
+      P(8)|P(9)|P(10)|P(11), P(9)|P(10), P(10), P(8)|P(9), P(10),
+      8, 1, 3, 5,
+      64, 0, 0, false },
+};
+
+struct Input {
+    std::string reg;
+    double offset; // extra latency before this input is consumed (e.g. address -> load)
+};
+
+struct InstrModel {
+    std::vector<PortMask> uops; // unfused-domain uops and the ports each may use
+    int fused = 0;              // fused-domain uops (front end)
+    int dsbSlots = 0;
+    std::vector<Input> reads;
+    std::vector<std::string> writes;
+    double latency = 0;
+    bool isBranch = false, taken = false, fusedWithPrev = false;
+    bool generic = false; // no model for this form, fallback numbers
+};
+
+const std::string FLAGS = "FLAGS";
+
+bool isBranch(const std::string& m) {
+    return m=="JMP" || m=="JE" || m=="JNE" || m=="CALL" || m=="RET";
+}
+
+bool endsBlock(const std::string& m) {
+    return m=="JMP" || m=="JE" || m=="JNE" || m=="RET";
+}
+
+void addressInputs(const ParsedOperand& mem, double offset, std::vector<Input>& reads) {
+    if (mem.base && *mem.base != "RIP") reads.push_back({ *mem.base, offset });
+    if (mem.index) reads.push_back({ *mem.index, offset });
+}
+
+// XMMn is the low half of YMMn: one register for dependency tracking
+std::string regKey(const std::string& r) {
+    if (r.size() > 3 && r.compare(0, 3, "XMM") == 0) return "YMM" + r.substr(3);
+    return r;
+}
+
+bool isVecReg(const ParsedOperand& o) {
+    return o.kind==ParsedOperand::REG && o.text.size() > 3 &&
+           (o.text.compare(0, 3, "XMM") == 0 || o.text.compare(0, 3, "YMM") == 0);
+}
+
+// SSE/AVX forms (see InstructionEncoder's vecOps). Loads and stores are split
+// into their load/store uops like the scalar forms; a memory source is one
+// fused-domain uop with the operation (micro-fusion).
+bool vectorModel(const ParsedInstruction& pi, const UArch& u, InstrModel& m) {
+    const std::string &mn = pi.mnemonic;
+    const auto &ops = pi.operands;
+    const std::string base = mn[0] == 'V' ? mn.substr(1) : mn;
+    bool vex = mn[0] == 'V';
+
+    if (base == "MOVDQU" && ops.size() == 2) {
+        const ParsedOperand &d = ops[0], &s = ops[1];
+        if (isVecReg(d) && isVecReg(s)) {
+            m.reads = { { regKey(s.text), 0 } }; m.writes = { regKey(d.text) };
+            if (u.moveElim) m.latency = 0;
+            else { m.uops = { u.vecAlu }; m.latency = 1; }
+        } else if (isVecReg(d) && s.kind==ParsedOperand::MEM) {
+            addressInputs(s, 0, m.reads); m.writes = { regKey(d.text) };
+            m.uops = { u.load }; m.latency = u.vecLoadLat;
+        } else if (d.kind==ParsedOperand::MEM && isVecReg(s)) {
+            addressInputs(d, 0, m.reads); m.reads.push_back({ regKey(s.text), 0 });
+            m.uops = { u.storeAddr, u.vecStoreData };
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    bool alu = base == "PADDD" || base == "PXOR" || base == "PCMPEQB";
+    bool fma = mn.compare(0, 6, "VFMADD") == 0;
+    if ((alu || fma) && ops.size() == (vex ? 3u : 2u)) {
+        // SSE: dst op= src; VEX: dst = src1 op src2; FMA also reads the accumulator (dst)
+        const ParsedOperand &d = ops[0], &last = ops.back();
+        std::vector<const ParsedOperand*> srcs;
+        if (!vex || fma) srcs.push_back(&d);
+        for (size_t k = 1; k < ops.size(); k++) srcs.push_back(&ops[k]);
+        if (!isVecReg(d)) return false;
+        m.writes = { regKey(d.text) };
+        // PXOR x,x / VPXOR x,y,y: zero idiom, no input and no execution uop
+        if (base == "PXOR" && isVecReg(*srcs[srcs.size()-2]) && isVecReg(last) &&
+            regKey(srcs[srcs.size()-2]->text) == regKey(last.text)) {
+            m.latency = 0;
+            return true;
+        }
+        for (auto *o : srcs) if (isVecReg(*o)) m.reads.push_back({ regKey(o->text), 0 });
+        m.uops = { fma ? u.fma : u.vecAlu };
+        m.latency = fma ? u.fmaLat : 1;
+        if (last.kind==ParsedOperand::MEM) {
+            addressInputs(last, u.vecLoadLat, m.reads);
+            m.uops.insert(m.uops.begin(), u.load);
+        }
+        return true;
+    }
+
+    if (base == "PMOVMSKB" && ops.size() == 2 && ops[0].kind==ParsedOperand::REG && isVecReg(ops[1])) {
+        m.reads = { { regKey(ops[1].text), 0 } }; m.writes = { ops[0].text };
+        m.uops = { u.vecMask }; m.latency = u.maskLat;
+        return true;
+    }
+
+    if ((mn == "VBROADCASTSS" || mn == "VBROADCASTSD" || mn == "VPBROADCASTD") && ops.size() == 2 && isVecReg(ops[0])) {
+        m.writes = { regKey(ops[0].text) };
+        if (ops[1].kind==ParsedOperand::MEM) {
+            // broadcast from memory is done by the load port
+            addressInputs(ops[1], 0, m.reads);
+            m.uops = { u.load }; m.latency = u.vecLoadLat;
+        } else {
+            m.reads = { { regKey(ops[1].text), 0 } };
+            m.uops = { u.vecShuffle }; m.latency = u.shuffleLat;
+        }
+        return true;
+    }
+    return false;
+}
+
+InstrModel model(const ParsedInstruction& pi, const ParsedInstruction* prev, const UArch& u) {
+    InstrModel m;
+    const std::string &mn = pi.mnemonic;
+    const auto &ops = pi.operands;
+    m.fused = 1;
+    m.dsbSlots = 1;
+    m.isBranch = isBranch(mn);
+
+    if (mn=="MOV" && ops.size()==2) {
+        const ParsedOperand &d = ops[0], &s = ops[1];
+        if (d.kind==ParsedOperand::REG && s.kind==ParsedOperand::IMM) {
+            m.writes = { d.text }; m.uops = { u.alu }; m.latency = u.aluLat;
+            m.dsbSlots = 2; // imm64 takes two uop-cache slots
+        } else if (d.kind==ParsedOperand::REG && s.kind==ParsedOperand::REG) {
+            m.reads = { { s.text, 0 } }; m.writes = { d.text };
+            if (u.moveElim) m.latency = 0;
+            else { m.uops = { u.alu }; m.latency = u.aluLat; }
+        } else if (d.kind==ParsedOperand::REG && s.kind==ParsedOperand::MEM) {
+            addressInputs(s, 0, m.reads); m.writes = { d.text };
+            m.uops = { u.load }; m.latency = u.loadLat;
+        } else if (d.kind==ParsedOperand::MEM && s.kind==ParsedOperand::REG) {
+            addressInputs(d, 0, m.reads); m.reads.push_back({ s.text, 0 });
+            m.uops = { u.storeAddr, u.storeData };
+        }
+        return m;
+    }
+
+    if ((mn=="ADD" || mn=="SUB" || mn=="CMP") && ops.size()==2) {
+        const ParsedOperand &a = ops[0], &b = ops[1];
+        bool writesDst = mn != "CMP";
+        m.writes = { FLAGS };
+        m.latency = u.aluLat;
+        if (a.kind==ParsedOperand::REG) {
+            m.reads.push_back({ a.text, 0 });
+            if (writesDst) m.writes.push_back(a.text);
+            if (b.kind==ParsedOperand::REG) m.reads.push_back({ b.text, 0 });
+            if (b.kind==ParsedOperand::MEM) {
+                addressInputs(b, u.loadLat, m.reads);
+                m.uops = { u.load, u.alu };
+            } else {
+                m.uops = { u.alu };
+            }
+        } else if (a.kind==ParsedOperand::MEM) {
+            addressInputs(a, u.loadLat, m.reads);
+            if (b.kind==ParsedOperand::REG) m.reads.push_back({ b.text, 0 });
+            if (writesDst) {
+                // read-modify-write: load + op + store-address + store-data
+                m.uops = { u.load, u.alu, u.storeAddr, u.storeData };
+                m.fused = 2;
+                m.dsbSlots = 2;
+            } else {
+                m.uops = { u.load, u.alu };
+            }
+        }
+        return m;
+    }
+
+    if (mn=="JMP") {
+        m.uops = { u.takenBranch };
+        m.taken = true;
+        return m;
+    }
+    if (mn=="JE" || mn=="JNE") {
+        m.reads = { { FLAGS, 0 } };
+        m.uops = { u.branch };
+        // CMP/ADD/SUB reg,reg|imm directly before a Jcc decode into one uop
+        if (prev && !pi.label && prev->operands.size()==2 &&
+            prev->operands[0].kind==ParsedOperand::REG && prev->operands[1].kind!=ParsedOperand::MEM &&
+            (prev->mnemonic=="CMP" || (u.fuseAluJcc && (prev->mnemonic=="ADD" || prev->mnemonic=="SUB")))) {
+            m.fused = 0;
+            m.dsbSlots = 0;
+            m.fusedWithPrev = true;
+        }
+        return m;
+    }
+    if (mn=="CALL") {
+        m.reads = { { "RSP", 0 } }; m.writes = { "RSP" }; m.latency = 1;
+        m.uops = { u.storeAddr, u.storeData, u.takenBranch };
+        m.fused = 2; m.dsbSlots = 2;
+        m.taken = true;
+        return m;
+    }
+    if (mn=="RET") {
+        m.reads = { { "RSP", 0 } }; m.writes = { "RSP" }; m.latency = 1;
+        m.uops = { u.load, u.takenBranch };
+        m.fused = 2; m.dsbSlots = 2;
+        m.taken = true;
+        return m;
+    }
+    if (vectorModel(pi, u, m)) return m;
+    // unknown forms: one generic ALU uop
+    m.uops = { u.alu };
+    m.latency = u.aluLat;
+    m.generic = true;
+    return m;
+}
+
+std::string hex(uint64_t v) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "0x%04llx", (unsigned long long)v);
+    return buf;
+}
+
+std::string fmt(double v) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.2f", v);
+    return buf;
+}
+
+std::string describe(const ListingEntry& e) {
+    return "line " + std::to_string(e.instr.sourceLine) + " " + e.instr.mnemonic;
+}
+
+struct Ready {
+    double time = 0;
+    int producer = -1; // position in the sequence, -1 for live-in
+};
+
+// Longest register/flags dependency chain through `seq` (listing indices),
+// starting with every input ready at cycle 0.
+double criticalPath(const std::vector<size_t>& seq, const std::vector<InstrModel>& models, std::vector<size_t>& chain) {
+    std::unordered_map<std::string, Ready> ready;
+    std::vector<double> finish(seq.size(), 0);
+    std::vector<int> pred(seq.size(), -1);
+    double best = 0;
+    int last = -1;
+    for (size_t p = 0; p < seq.size(); p++) {
+        const InstrModel &m = models[seq[p]];
+        double start = 0;
+        for (auto &in : m.reads) {
+            auto it = ready.find(in.reg);
+            double t = (it != ready.end() ? it->second.time : 0) + in.offset;
+            if (t > start || (t == start && pred[p] < 0 && it != ready.end())) {
+                start = t;
+                pred[p] = it != ready.end() ? it->second.producer : -1;
+            }
+        }
+        finish[p] = start + m.latency;
+        for (auto &w : m.writes) ready[w] = { finish[p], (int)p };
+        if (finish[p] > best) { best = finish[p]; last = (int)p; }
+    }
+    chain.clear();
+    for (int p = last; p >= 0; p = pred[p]) chain.push_back(seq[p]);
+    std::reverse(chain.begin(), chain.end());
+    return best;
+}
+
+// Loop-carried recurrence: run the body repeatedly with unlimited resources and
+// measure how fast the ready time of each register grows per iteration. The
+// chain is the cycle through the fastest-growing register, traced back from its
+// last writer to the value carried in from the previous iteration.
+double recurrence(const std::vector<size_t>& body, const std::vector<InstrModel>& models,
+                  std::string& reg, std::vector<size_t>& chain) {
+    const int warm = 8, total = 16;
+    std::unordered_map<std::string, Ready> ready;
+    std::unordered_map<std::string, double> readyWarm;
+    std::vector<int> pred(body.size(), -1);
+    for (int k = 1; k <= total; k++) {
+        for (auto &kv : ready) kv.second.producer = -1; // now carried in
+        for (size_t p = 0; p < body.size(); p++) {
+            const InstrModel &m = models[body[p]];
+            double start = 0;
+            pred[p] = -1;
+            for (auto &in : m.reads) {
+                auto it = ready.find(in.reg);
+                if (it == ready.end()) continue;
+                double t = it->second.time + in.offset;
+                if (t > start) { start = t; pred[p] = it->second.producer; }
+            }
+            for (auto &w : m.writes) ready[w] = { start + m.latency, (int)p };
+        }
+        if (k == warm) for (auto &kv : ready) readyWarm[kv.first] = kv.second.time;
+    }
+    double rate = 0;
+    reg.clear();
+    for (auto &kv : ready) {
+        if (kv.first == FLAGS) continue; // flags only carry what a register chain already does
+        double r = (kv.second.time - readyWarm[kv.first]) / (total - warm);
+        if (r > rate + 1e-9) { rate = r; reg = kv.first; }
+    }
+    chain.clear();
+    if (rate > 0) {
+        for (int p = ready[reg].producer; p >= 0; p = pred[p]) chain.push_back(body[p]);
+        std::reverse(chain.begin(), chain.end());
+    }
+    return rate;
+}
+
+// Lower bound on cycles from execution ports: for every set of ports S, the uops
+// that can only run inside S need at least count/|S| cycles. The max over all S
+// is what an optimal scheduler achieves.
+double portBound(const std::vector<PortMask>& uops, const UArch& u, PortMask& busiest) {
+    double best = 0;
+    busiest = 0;
+    for (PortMask set = 1; set < (1u << u.ports); set++) {
+        int n = 0;
+        for (PortMask pm : uops) if (pm && (pm & ~set) == 0) n++;
+        double b = (double)n / __builtin_popcount(set);
+        if (b > best + 1e-9) { best = b; busiest = set; }
+    }
+    return best;
+}
+
+std::string portSetName(PortMask set, const UArch& u) {
+    std::string s;
+    for (int p = 0; p < u.ports; p++) {
+        if (!(set & P(p))) continue;
+        if (!s.empty()) s += "+";
+        s += u.portNames[p];
+    }
+    return s.empty() ? "-" : s;
+}
+
+} // namespace
+
+std::vector<std::string> analyzerMicroarchs() {
+    std::vector<std::string> names;
+    for (auto &u : uarchs) names.push_back(u.name);
+    return names;
+}
+
+void analyzeListing(const std::vector<ListingEntry>& listing, const std::string& march, std::ostream& out) {
+    const UArch* found = nullptr;
+    for (auto &u : uarchs) if (march == u.name) found = &u;
+    if (!found) throw std::runtime_error("Unknown microarchitecture: " + march);
+    const UArch &u = *found;
+
+    // models for real instructions; label-only lines get an empty model
+    std::vector<InstrModel> models(listing.size());
+    std::unordered_map<std::string, size_t> labelIndex;
+    size_t prev = listing.size();
+    for (size_t i = 0; i < listing.size(); i++) {
+        const ParsedInstruction &pi = listing[i].instr;
+        if (pi.label) labelIndex[*pi.label] = i;
+        if (pi.mnemonic.empty()) continue;
+        models[i] = model(pi, prev < listing.size() ? &listing[prev].instr : nullptr, u);
+        if (models[i].fusedWithPrev) {
+            // the fused pair is a single uop on a branch port
+            models[prev].uops.back() = u.branch;
+            models[i].uops.clear();
+        }
+        prev = i;
+    }
+
+    auto chainText = [&](const std::vector<size_t>& chain) {
+        std::string s;
+        for (size_t k = 0; k < chain.size(); k++) {
+            if (k) s += " -> ";
+            s += describe(listing[chain[k]]);
+        }
+        return s;
+    };
+
+    out << "Static analysis for " << u.name << " (code assumed " << u.lineBytes << "-byte aligned)\n";
+
+    // basic blocks: split at labels and after JMP/Jcc/RET
+    out << "\nBasic blocks:\n";
+    std::vector<size_t> cur;
+    std::string curName;
+    auto flush = [&]() {
+        if (cur.empty()) return;
+        int fused = 0;
+        for (size_t i : cur) fused += models[i].fused;
+        const ListingEntry &first = listing[cur.front()], &lastE = listing[cur.back()];
+        std::vector<size_t> chain;
+        double cp = criticalPath(cur, models, chain);
+        out << "  " << (curName.empty() ? "(fallthrough)" : curName)
+            << " " << hex(first.address) << "-" << hex(lastE.address + lastE.size)
+            << ": " << cur.size() << " instrs, " << fused << " uops, "
+            << (lastE.address + lastE.size - first.address) << " bytes, critical path "
+            << fmt(cp) << " cycles";
+        if (!chain.empty()) out << " (" << chainText(chain) << ")";
+        out << "\n";
+        cur.clear();
+        curName.clear();
+    };
+    for (size_t i = 0; i < listing.size(); i++) {
+        const ParsedInstruction &pi = listing[i].instr;
+        if (pi.label) {
+            flush();
+            curName = *pi.label;
+        }
+        if (pi.mnemonic.empty()) continue;
+        cur.push_back(i);
+        if (endsBlock(pi.mnemonic)) flush();
+    }
+    flush();
+
+    // loops: every backward branch closes a loop starting at its target
+    out << "\nLoops:\n";
+    size_t loops = 0;
+    for (size_t i = 0; i < listing.size(); i++) {
+        const ParsedInstruction &pi = listing[i].instr;
+        if (!(pi.mnemonic=="JMP" || pi.mnemonic=="JE" || pi.mnemonic=="JNE")) continue;
+        if (pi.operands.size()!=1 || pi.operands[0].kind!=ParsedOperand::LABEL) continue;
+        auto it = labelIndex.find(pi.operands[0].text);
+        if (it == labelIndex.end() || it->second > i) continue;
+
+        std::vector<size_t> body;
+        bool straight = true;
+        for (size_t k = it->second; k <= i; k++) {
+            const std::string &mk = listing[k].instr.mnemonic;
+            if (mk.empty()) continue;
+            // an unconditional exit before the closing branch means this range is not one loop
+            if (k != i && (mk=="JMP" || mk=="RET")) straight = false;
+            body.push_back(k);
+        }
+        if (!straight) continue;
+        loops++;
+
+        std::vector<PortMask> uops;
+        int fused = 0, taken = 0;
+        for (size_t k : body) {
+            const InstrModel &m = models[k];
+            fused += m.fused;
+            if (m.taken || k == i) taken++; // inner forward branches assumed not taken
+            uops.insert(uops.end(), m.uops.begin(), m.uops.end());
+        }
+        PortMask busiest = 0;
+        double portCycles = portBound(uops, u, busiest);
+        std::string reg;
+        std::vector<size_t> chain;
+        double rec = recurrence(body, models, reg, chain);
+        double feBound = fused / u.issueWidth;
+        double brBound = taken;
+
+        double cycles = std::max({ rec, portCycles, feBound, brBound });
+        const char* bottleneck = cycles == rec ? "dependency chain"
+                               : cycles == portCycles ? "port pressure"
+                               : cycles == feBound ? "front end" : "taken branches";
+
+        out << "  " << it->first << " " << hex(listing[it->second].address) << "-"
+            << hex(listing[i].address + listing[i].size) << " (line " << listing[it->second].instr.sourceLine
+            << " to line " << pi.sourceLine << "): " << body.size() << " instrs, " << fused << " uops\n";
+        out << "    estimated " << fmt(cycles) << " cycles/iteration, bound by " << bottleneck << "\n";
+        out << "    dependency chain " << fmt(rec) << (reg.empty() ? "" : " (through " + reg + ")")
+            << ", ports " << fmt(portCycles) << " (" << portSetName(busiest, u) << ")"
+            << ", front end " << fmt(feBound) << ", taken branches " << fmt(brBound) << "\n";
+        if (!chain.empty()) out << "    loop-carried chain: " << chainText(chain) << "\n";
+    }
+    if (!loops) out << "  none found (a loop is a backward branch with no JMP/RET before it)\n";
+
+    // layout warnings
+    out << "\nWarnings:\n";
+    size_t warnings = 0;
+    for (size_t i = 0; i < listing.size(); i++) {
+        const ListingEntry &e = listing[i];
+        if (e.instr.mnemonic.empty() || !isBranch(e.instr.mnemonic)) continue;
+        uint64_t end = e.address + e.size;
+        if (e.address / u.lineBytes != (end - 1) / u.lineBytes) {
+            out << "  " << describe(e) << " at " << hex(e.address) << " crosses a "
+                << u.lineBytes << "-byte cache line\n";
+            warnings++;
+        }
+        if (u.jccErratum) {
+            // a macro-fused pair counts from the start of the flag-setting instruction
+            uint64_t start = e.address;
+            if (models[i].fusedWithPrev) {
+                for (size_t k = i; k-- > 0; ) if (!listing[k].instr.mnemonic.empty()) { start = listing[k].address; break; }
+            }
+            if (start / 32 != (end - 1) / 32 || end % 32 == 0) {
+                out << "  " << describe(e) << " at " << hex(start) << " crosses or ends on a 32-byte boundary"
+                    << " (JCC erratum: not cached in the uop cache)\n";
+                warnings++;
+            }
+        }
+    }
+    if (u.dsbWindowBytes) {
+        std::unordered_map<uint64_t, int> slots;
+        std::vector<uint64_t> windows;
+        for (size_t i = 0; i < listing.size(); i++) {
+            if (listing[i].instr.mnemonic.empty()) continue;
+            uint64_t w = listing[i].address / u.dsbWindowBytes;
+            if (!slots.count(w)) windows.push_back(w);
+            slots[w] += models[i].dsbSlots;
+        }
+        for (uint64_t w : windows) {
+            if (slots[w] <= (int)u.dsbSlotsPerWindow) continue;
+            out << "  " << hex(w * u.dsbWindowBytes) << "-" << hex((w + 1) * u.dsbWindowBytes) << ": "
+                << slots[w] << " uop-cache slots in one " << u.dsbWindowBytes << "-byte window (max "
+                << u.dsbSlotsPerWindow << "), runs from the legacy decoders\n";
+            warnings++;
+        }
+    }
+    // forms without a model are counted as one 1-cycle ALU uop; say so once per mnemonic
+    std::unordered_map<std::string, size_t> unmodeled;
+    for (size_t i = 0; i < listing.size(); i++) {
+        if (!models[i].generic || unmodeled.count(listing[i].instr.mnemonic)) continue;
+        unmodeled[listing[i].instr.mnemonic] = i;
+        out << "  " << describe(listing[i]) << ": form not modeled, counted as one "
+            << fmt(u.aluLat) << "-cycle ALU uop without register dependencies\n";
+        warnings++;
+    }
+    if (!warnings) out << "  none\n";
+}
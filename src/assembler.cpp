@@ -0,0 +1,245 @@
+#include "assembler.hpp"
+#include "lexer.hpp"
+#include "parser.hpp"
+#include "scheduler.hpp"
+#include "profile.hpp"
+#include "encode_cache.hpp"
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <fstream>
+#include <sstream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// One line-aligned slice of a unit. Chunks are lexed, sized and encoded
+// independently; only the label table is merged between the passes.
+struct Chunk {
+    size_t begin = 0, end = 0;   // byte range in the source
+    size_t firstLine = 1;
+    std::vector<ParsedInstruction> instrs;
+    std::vector<uint64_t> sizes; // pass-1 size per instruction
+    uint64_t size = 0;           // sum of sizes
+    uint64_t base = 0;           // address of the first byte
+    std::vector<uint8_t> bytes;
+    std::vector<std::string> errors;
+    EncodingCache* cache = nullptr; // shared by both passes, null when disabled
+    std::unique_ptr<EncodingCache> ownCache;
+};
+
+std::string lineError(size_t line, const std::string& msg) {
+    return "line " + std::to_string(line) + ": " + msg;
+}
+
+std::vector<Chunk> splitSource(const std::string& src, size_t splitBytes) {
+    std::vector<Chunk> chunks;
+    size_t pos = 0, line = 1;
+    while (pos < src.size() || chunks.empty()) {
+        Chunk c;
+        c.begin = pos;
+        c.firstLine = line;
+        size_t cut = src.size();
+        if (splitBytes && src.size() - pos > splitBytes) {
+            size_t nl = src.find('\n', pos + splitBytes);
+            if (nl != std::string::npos) cut = nl + 1;
+        }
+        c.end = cut;
+        for (size_t i = c.begin; i < c.end; i++) if (src[i] == '\n') line++;
+        pos = cut;
+        chunks.push_back(std::move(c));
+    }
+    return chunks;
+}
+
+void parseChunk(const std::string& src, Chunk& c) {
+    try {
+        Lexer lex(src.substr(c.begin, c.end - c.begin), c.firstLine);
+        Parser parser(lex);
+        c.instrs = parser.parseAll();
+        c.errors = parser.errors();
+    } catch (const std::exception& ex) {
+        c.errors.push_back(std::string("parse error: ") + ex.what());
+    }
+}
+
+// Block reordering needs the whole unit: merge the chunks, reorder, then deal the
+// instructions back out in equal slices so sizing and encoding stay parallel.
+void applyProfile(std::vector<Chunk>& chunks, const Profile& profile, std::ostream* trace) {
+    for (auto &c : chunks) if (!c.errors.empty()) return;
+    std::vector<ParsedInstruction> all;
+    for (auto &c : chunks) {
+        all.insert(all.end(), std::make_move_iterator(c.instrs.begin()), std::make_move_iterator(c.instrs.end()));
+        c.instrs.clear();
+    }
+    ReorderStats st;
+    all = reorderBlocks(all, profile, &st);
+    if (trace) {
+        *trace << "PGO: " << st.blocks << " blocks, " << st.coldBlocks << " cold moved to end, "
+               << st.invertedBranches << " branches inverted, " << st.addedJumps << " jumps added, "
+               << st.removedJumps << " jumps removed\n";
+    }
+    size_t per = (all.size() + chunks.size() - 1) / chunks.size();
+    for (size_t i = 0; i < chunks.size(); i++) {
+        size_t b = std::min(all.size(), i * per), e = std::min(all.size(), b + per);
+        chunks[i].instrs.assign(std::make_move_iterator(all.begin() + b), std::make_move_iterator(all.begin() + e));
+    }
+}
+
+} // namespace
+
+Assembler::Assembler(const InstructionEncoder& enc) : encoder(enc) {}
+
+uint64_t Assembler::estimateSize(const std::string& m) {
+    if (m=="JMP" || m=="CALL") return 5;
+    if (m=="JE" || m=="JNE") return 6;
+    return 1;
+}
+
+AssemblyResult Assembler::assemble(const std::string& src, WorkStealingPool* pool, std::ostream* trace) const {
+    AssemblyResult res;
+    assemble(src, res, nullptr, pool, trace);
+    return res;
+}
+
+void Assembler::assemble(const std::string& src, AssemblyResult& res, EncodingCache* cache, WorkStealingPool* pool, std::ostream* trace) const {
+    res.ok = true;
+    res.bytes.clear();
+    res.labels.clear();
+    res.errors.clear();
+    res.cacheStats = EncodingCache::Stats();
+    res.listing.clear();
+    if (trace || cache) pool = nullptr;
+    std::vector<Chunk> chunks = splitSource(src, pool ? splitBytes : 0);
+    EncodingCache::Stats statsBefore;
+    if (cache) {
+        statsBefore = cache->stats();
+        chunks[0].cache = cache;
+    } else if (useCache) {
+        for (auto &c : chunks) {
+            c.ownCache = std::make_unique<EncodingCache>(encoder, timeCache);
+            c.cache = c.ownCache.get();
+        }
+    }
+
+    auto forEachChunk = [&](const std::function<void(Chunk&)>& fn) {
+        if (pool && chunks.size() > 1) pool->parallelFor(chunks.size(), [&](size_t i) { fn(chunks[i]); });
+        else for (auto &c : chunks) fn(c);
+    };
+
+    // pass 1: parse and size every instruction. rel32/disp32 sizes don't depend
+    // on the target, so no label addresses are needed here.
+    forEachChunk([&](Chunk& c) { parseChunk(src, c); });
+    if (profile) applyProfile(chunks, *profile, trace);
+    forEachChunk([&](Chunk& c) {
+        c.sizes.reserve(c.instrs.size());
+        for (auto &pi : c.instrs) {
+            uint64_t sz = 0;
+            if (!pi.mnemonic.empty()) {
+                try {
+                    sz = c.cache ? c.cache->instructionSize(pi) : encoder.instructionSize(pi);
+                } catch (...) {
+                    sz = estimateSize(pi.mnemonic); // reported properly in pass 2
+                }
+            }
+            c.sizes.push_back(sz);
+            c.size += sz;
+        }
+    });
+
+    // layout: chunk bases and the unit-wide label table (later definitions win)
+    size_t labelCount = 0;
+    for (auto &c : chunks) for (auto &pi : c.instrs) if (pi.label) labelCount++;
+    res.labels.reserve(labelCount);
+    uint64_t addr = 0;
+    for (auto &c : chunks) {
+        c.base = addr;
+        uint64_t a = c.base;
+        for (size_t i = 0; i < c.instrs.size(); i++) {
+            if (c.instrs[i].label) res.labels[*c.instrs[i].label] = a;
+            a += c.sizes[i];
+        }
+        addr += c.size;
+    }
+
+    if (trace) {
+        *trace << "Pass1: assigned " << res.labels.size() << " labels:\n";
+        for (auto &kv : res.labels) *trace << "  " << kv.first << " -> " << kv.second << "\n";
+    }
+
+    // pass 2: encode against the final label table
+    forEachChunk([&](Chunk& c) {
+        if (!c.errors.empty()) return;
+        c.bytes.reserve(c.size);
+        uint64_t a = c.base;
+        for (size_t i = 0; i < c.instrs.size(); i++) {
+            auto &pi = c.instrs[i];
+            if (pi.mnemonic.empty()) continue;
+            try {
+                size_t n;
+                if (c.cache) {
+                    n = c.cache->encodeInstruction(pi, res.labels, a, c.bytes);
+                } else {
+                    Encoded e = encoder.encodeInstruction(pi, res.labels, a);
+                    c.bytes.insert(c.bytes.end(), e.bytes.begin(), e.bytes.end());
+                    n = e.bytes.size();
+                }
+                if (trace) {
+                    *trace << "instr[" << i << "] line=" << pi.sourceLine
+                           << " mnemonic=" << pi.mnemonic
+                           << " bytes=" << n
+                           << " addr=" << a << "\n";
+                }
+                if (n != c.sizes[i]) {
+                    c.errors.push_back(lineError(pi.sourceLine, "size of " + pi.mnemonic + " changed between passes"));
+                }
+            } catch (const std::exception& ex) {
+                c.errors.push_back(lineError(pi.sourceLine, ex.what()));
+            }
+            a += c.sizes[i];
+        }
+    });
+
+    size_t total = 0;
+    for (auto &c : chunks) {
+        res.errors.insert(res.errors.end(), c.errors.begin(), c.errors.end());
+        total += c.bytes.size();
+        if (c.cache) res.cacheStats.merge(c.cache->stats());
+    }
+    if (cache) res.cacheStats.subtract(statsBefore); // only this unit's share of a cache that outlives the call
+    if (trace && (useCache || cache)) {
+        res.cacheStats.print(*trace, timeCache);
+        *trace << "\n";
+    }
+    res.ok = res.errors.empty();
+    if (!res.ok) return;
+
+    res.bytes.reserve(total);
+    for (auto &c : chunks) res.bytes.insert(res.bytes.end(), c.bytes.begin(), c.bytes.end());
+    if (keepListing) {
+        for (auto &c : chunks) {
+            uint64_t a = c.base;
+            for (size_t i = 0; i < c.instrs.size(); i++) {
+                res.listing.push_back({ std::move(c.instrs[i]), a, c.sizes[i] });
+                a += c.sizes[i];
+            }
+        }
+    }
+}
+
+bool readFile(const std::string& path, std::string& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::stringstream ss; ss << in.rdbuf();
+    out = ss.str();
+    return true;
+}
+
+bool writeFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+    if (bytes.size() > static_cast<size_t>(std::numeric_limits<std::streamsize>::max())) return false;
+    std::ofstream of(path, std::ios::binary);
+    if (!of) return false;
+    of.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return (bool)of;
+}
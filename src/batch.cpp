@@ -0,0 +1,91 @@
+#include "batch.hpp"
+#include "assembler.hpp"
+#include "encoder.hpp"
+#include "scheduler.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+std::vector<BatchJob> readManifest(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Failed to open manifest " + path);
+    std::vector<BatchJob> jobs;
+    std::string line;
+    size_t lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        std::istringstream ls(line);
+        BatchJob job;
+        if (!(ls >> job.input) || job.input[0] == '#') continue;
+        std::string extra;
+        if (!(ls >> job.output) || (ls >> extra)) {
+            throw std::runtime_error(path + ":" + std::to_string(lineNo) + ": expected \"input output\"");
+        }
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+size_t runBatch(const std::vector<BatchJob>& jobs, const BatchOptions& opts, std::ostream& log) {
+    struct UnitStatus {
+        std::vector<std::string> errors;
+        size_t bytes = 0;
+        EncodingCache::Stats cache;
+    };
+    std::vector<UnitStatus> status(jobs.size());
+
+    // schedule the largest units first so they don't end up as the long tail
+    std::vector<std::pair<uintmax_t,size_t>> order;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        std::error_code ec;
+        uintmax_t sz = std::filesystem::file_size(jobs[i].input, ec);
+        order.push_back({ ec ? 0 : sz, i });
+    }
+    std::stable_sort(order.begin(), order.end(), [](auto &a, auto &b) { return a.first > b.first; });
+
+    const InstructionEncoder encoder;
+    Assembler assembler(encoder);
+    assembler.useCache = opts.useCache;
+    assembler.timeCache = opts.stats;
+    {
+        WorkStealingPool pool(opts.threads);
+        for (auto &o : order) {
+            size_t i = o.second;
+            pool.submit([&, i] {
+                UnitStatus &st = status[i];
+                try {
+                    std::string src;
+                    if (!readFile(jobs[i].input, src)) { st.errors.push_back("Failed to open " + jobs[i].input); return; }
+                    AssemblyResult res = assembler.assemble(src, &pool);
+                    st.cache = res.cacheStats;
+                    if (!res.ok) { st.errors = std::move(res.errors); return; }
+                    if (!writeFile(jobs[i].output, res.bytes)) { st.errors.push_back("Failed to write " + jobs[i].output); return; }
+                    st.bytes = res.bytes.size();
+                } catch (const std::exception& ex) {
+                    st.errors.push_back(ex.what());
+                }
+            });
+        }
+        pool.waitIdle();
+    }
+
+    size_t failed = 0;
+    EncodingCache::Stats cache;
+    for (auto &st : status) cache.merge(st.cache);
+    for (size_t i = 0; i < jobs.size(); i++) {
+        if (status[i].errors.empty()) {
+            log << jobs[i].input << ": wrote " << status[i].bytes << " bytes to " << jobs[i].output << "\n";
+            continue;
+        }
+        failed++;
+        for (auto &e : status[i].errors) log << jobs[i].input << ": " << e << "\n";
+    }
+    log << "Batch: " << (jobs.size() - failed) << "/" << jobs.size() << " units assembled\n";
+    if (opts.stats && opts.useCache) {
+        cache.print(log, true);
+        log << "\n";
+    }
+    return failed;
+}
@@ -0,0 +1,88 @@
+#include "client.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+AssemblerClient::AssemblerClient(const std::string& socketPath) {
+    sockaddr_un sa{};
+    if (socketPath.size() >= sizeof(sa.sun_path)) throw std::runtime_error("Socket path too long: " + socketPath);
+    sa.sun_family = AF_UNIX;
+    std::strncpy(sa.sun_path, socketPath.c_str(), sizeof(sa.sun_path) - 1);
+    fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) throw std::runtime_error(std::string("socket: ") + std::strerror(errno));
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)) < 0) {
+        std::string err = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("connect " + socketPath + ": " + err);
+    }
+}
+
+AssemblerClient::~AssemblerClient() {
+    if (fd >= 0) ::close(fd);
+}
+
+rae_proto::Response AssemblerClient::assemble(const rae_proto::Request& req) {
+    rae_proto::encodeRequest(req, buf);
+    rae_proto::writeFrame(fd, buf);
+    if (!rae_proto::readFrame(fd, buf)) throw std::runtime_error("Server closed the connection");
+    rae_proto::Response resp;
+    rae_proto::decodeResponse(buf, resp);
+    return resp;
+}
+
+size_t runLoadGenerator(const std::string& socketPath, const std::string& source,
+                        unsigned connections, size_t requests, std::ostream& out) {
+    using clock = std::chrono::steady_clock;
+    if (connections == 0) connections = 1;
+    std::vector<std::vector<double>> latencies(connections); // microseconds, per connection
+    std::atomic<size_t> failed{0};
+
+    rae_proto::Request req;
+    req.source = source;
+
+    auto start = clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned c = 0; c < connections; c++) {
+        threads.emplace_back([&, c] {
+            try {
+                AssemblerClient client(socketPath);
+                latencies[c].reserve(requests);
+                for (size_t i = 0; i < requests; i++) {
+                    auto t0 = clock::now();
+                    rae_proto::Response resp = client.assemble(req);
+                    latencies[c].push_back(std::chrono::duration<double, std::micro>(clock::now() - t0).count());
+                    if (!resp.ok) failed++;
+                }
+            } catch (const std::exception&) {
+                failed += requests - latencies[c].size();
+            }
+        });
+    }
+    for (auto &t : threads) t.join();
+    double wall = std::chrono::duration<double>(clock::now() - start).count();
+
+    std::vector<double> all;
+    for (auto &l : latencies) all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+    auto pct = [&](double p) {
+        if (all.empty()) return 0.0;
+        size_t idx = std::min(all.size() - 1, (size_t)(p / 100.0 * (double)all.size()));
+        return all[idx];
+    };
+
+    out << std::fixed << std::setprecision(1);
+    out << "requests: " << all.size() << " completed, " << failed << " failed, "
+        << connections << " connections, " << wall << " s, "
+        << (wall > 0 ? (double)all.size() / wall : 0.0) << " req/s\n";
+    out << "latency us: p50=" << pct(50) << " p90=" << pct(90) << " p99=" << pct(99)
+        << " p99.9=" << pct(99.9) << " max=" << (all.empty() ? 0.0 : all.back()) << "\n";
+    return failed;
+}
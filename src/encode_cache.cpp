@@ -0,0 +1,170 @@
+#include "encode_cache.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+namespace {
+
+// the label a label-relative form refers to, and the constant added to it
+const std::string* labelRef(const ParsedInstruction& instr, int64_t& addend) {
+    for (auto &op : instr.operands) {
+        if (op.kind == ParsedOperand::LABEL) { addend = 0; return &op.text; }
+        if (op.kind == ParsedOperand::MEM && op.symbol) { addend = op.disp; return &*op.symbol; }
+    }
+    return nullptr;
+}
+
+// raw bytes rather than std::to_string: the key is built on every lookup
+template <class T>
+void appendRaw(std::string& key, T v) {
+    char buf[sizeof v];
+    std::memcpy(buf, &v, sizeof v);
+    key.append(buf, sizeof v);
+}
+
+void appendKey(std::string& key, const ParsedInstruction& instr) {
+    key.clear();
+    key += instr.mnemonic;
+    for (auto &op : instr.operands) {
+        key += '|';
+        key += (char)('0' + op.kind);
+        switch (op.kind) {
+        case ParsedOperand::REG:
+        case ParsedOperand::IMM:
+            key += op.text;
+            break;
+        case ParsedOperand::LABEL:
+            break; // patched per use
+        case ParsedOperand::MEM:
+            if (op.base) key += *op.base;
+            key += ',';
+            if (op.index) key += *op.index;
+            key += ',';
+            appendRaw(key, (int8_t)op.scale);
+            appendRaw(key, op.disp);
+            if (op.symbol) key += ",@"; // label patched per use, disp is part of the key
+            break;
+        }
+    }
+}
+
+uint64_t nowNanos() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+double EncodingCache::Counts::hitRate() const {
+    uint64_t total = lookups();
+    return total ? (double)hits / (double)total : 0.0;
+}
+
+void EncodingCache::Stats::merge(const Stats& o) {
+    size.hits += o.size.hits;
+    size.misses += o.size.misses;
+    encode.hits += o.encode.hits;
+    encode.misses += o.encode.misses;
+    hitNanos += o.hitNanos;
+    missNanos += o.missNanos;
+    samples += o.samples;
+    sampleNanos += o.sampleNanos;
+}
+
+void EncodingCache::Stats::subtract(const Stats& o) {
+    size.hits -= o.size.hits;
+    size.misses -= o.size.misses;
+    encode.hits -= o.encode.hits;
+    encode.misses -= o.encode.misses;
+    hitNanos -= o.hitNanos;
+    missNanos -= o.missNanos;
+    samples -= o.samples;
+    sampleNanos -= o.sampleNanos;
+}
+
+double EncodingCache::Stats::estimatedSpeedup() const {
+    uint64_t spent = hitNanos + missNanos;
+    if (!samples || !spent) return 0.0;
+    double uncached = (double)sampleNanos / (double)samples * (double)lookups();
+    return uncached / (double)spent;
+}
+
+void EncodingCache::Stats::print(std::ostream& os, bool withSpeedup) const {
+    os << "Cache: pass 1 " << size.hits << "/" << size.lookups() << " hits (" << size.hitRate() * 100.0
+       << "%), pass 2 " << encode.hits << "/" << encode.lookups() << " hits (" << encode.hitRate() * 100.0 << "%)";
+    if (withSpeedup) os << ", est. speedup " << estimatedSpeedup() << "x";
+}
+
+EncodingCache::EncodingCache(const InstructionEncoder& enc, bool t) : encoder(enc), timed(t) {}
+
+const EncodingCache::Entry& EncodingCache::lookup(const ParsedInstruction& instr, Counts& counts) {
+    appendKey(key, instr);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        counts.hits++;
+        return it->second;
+    }
+    // miss: encode with every referenced label at 0 to get the template
+    placeholders.clear();
+    int64_t addend = 0;
+    if (const std::string* l = labelRef(instr, addend)) placeholders[*l] = 0;
+    Encoded e = encoder.encodeInstruction(instr, placeholders, 0);
+    counts.misses++;
+    Entry &entry = entries.emplace(key, Entry()).first->second;
+    entry.bytes = std::move(e.bytes);
+    entry.relOffset = e.relOffset;
+    return entry;
+}
+
+// times what the encoder alone would spend on this lookup; errors are left to
+// the cached path, which reports them the same way
+template <class F>
+void EncodingCache::sample(F&& uncached) {
+    if (!timed || st.lookups() % sampleEvery != 0) return;
+    uint64_t t0 = nowNanos();
+    try {
+        uncached();
+    } catch (...) {
+        return;
+    }
+    st.sampleNanos += nowNanos() - t0;
+    st.samples++;
+}
+
+size_t EncodingCache::instructionSize(const ParsedInstruction& instr) {
+    sample([&] { (void)encoder.instructionSize(instr); });
+    uint64_t t0 = timed ? nowNanos() : 0;
+    uint64_t missesBefore = st.size.misses;
+    size_t n = lookup(instr, st.size).bytes.size();
+    if (timed) (st.size.misses != missesBefore ? st.missNanos : st.hitNanos) += nowNanos() - t0;
+    return n;
+}
+
+size_t EncodingCache::encodeInstruction(const ParsedInstruction& instr, const std::unordered_map<std::string,uint64_t>& labels, uint64_t currentAddress, std::vector<uint8_t>& out) {
+    sample([&] { (void)encoder.encodeInstruction(instr, labels, currentAddress); });
+    uint64_t t0 = timed ? nowNanos() : 0;
+    uint64_t missesBefore = st.encode.misses;
+    const Entry &entry = lookup(instr, st.encode);
+    size_t n = entry.bytes.size();
+    int64_t rel = 0;
+    if (entry.relOffset >= 0) {
+        int64_t addend = 0;
+        const std::string* l = labelRef(instr, addend);
+        auto it = l ? labels.find(*l) : labels.end();
+        if (it != labels.end()) rel = (int64_t)it->second + addend - (int64_t)(currentAddress + n);
+        if (it == labels.end() || rel < INT32_MIN || rel > INT32_MAX) {
+            // let the encoder produce its usual result or error
+            Encoded e = encoder.encodeInstruction(instr, labels, currentAddress);
+            out.insert(out.end(), e.bytes.begin(), e.bytes.end());
+            return e.bytes.size();
+        }
+    }
+    size_t at = out.size();
+    out.insert(out.end(), entry.bytes.begin(), entry.bytes.end());
+    if (entry.relOffset >= 0) {
+        for (int i = 0; i < 4; i++) out[at + entry.relOffset + i] = (uint8_t)((uint64_t)rel >> (i * 8));
+    }
+    if (timed) (st.encode.misses != missesBefore ? st.missNanos : st.hitNanos) += nowNanos() - t0;
+    return n;
+}
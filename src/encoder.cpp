@@ -3,6 +3,7 @@
 #include <cmath>
 #include <iostream>
 #include <cstring>
+#include <cstdint>
 
 InstructionEncoder::InstructionEncoder() {
     // basic reg64 map
@@ -10,15 +11,42 @@ InstructionEncoder::InstructionEncoder() {
         {"RAX",0},{"RCX",1},{"RDX",2},{"RBX",3},{"RSP",4},{"RBP",5},{"RSI",6},{"RDI",7},
         {"R8",8},{"R9",9},{"R10",10},{"R11",11},{"R12",12},{"R13",13},{"R14",14},{"R15",15}
     };
+    for (uint8_t i = 0; i < 16; i++) {
+        vecReg["XMM" + std::to_string(i)] = i;
+        vecReg["YMM" + std::to_string(i)] = i;
+    }
+
+    // form, vex, pp, map, opcode, storeOpcode, W, ymmOnly
+    vecOps = {
+        {"MOVDQU",       {VecOp::MOVE,  false, 2, 1, 0x6F, 0x7F, false, false}},
+        {"PADDD",        {VecOp::RM,    false, 1, 1, 0xFE, 0,    false, false}},
+        {"PXOR",         {VecOp::RM,    false, 1, 1, 0xEF, 0,    false, false}},
+        {"PCMPEQB",      {VecOp::RM,    false, 1, 1, 0x74, 0,    false, false}},
+        {"PMOVMSKB",     {VecOp::MASK,  false, 1, 1, 0xD7, 0,    false, false}},
+        {"VMOVDQU",      {VecOp::MOVE,  true,  2, 1, 0x6F, 0x7F, false, false}},
+        {"VPADDD",       {VecOp::RVM,   true,  1, 1, 0xFE, 0,    false, false}},
+        {"VPXOR",        {VecOp::RVM,   true,  1, 1, 0xEF, 0,    false, false}},
+        {"VPCMPEQB",     {VecOp::RVM,   true,  1, 1, 0x74, 0,    false, false}},
+        {"VPMOVMSKB",    {VecOp::MASK,  true,  1, 1, 0xD7, 0,    false, false}},
+        {"VBROADCASTSS", {VecOp::BCAST, true,  1, 2, 0x18, 0,    false, false}},
+        {"VBROADCASTSD", {VecOp::BCAST, true,  1, 2, 0x19, 0,    false, true}},
+        {"VPBROADCASTD", {VecOp::BCAST, true,  1, 2, 0x58, 0,    false, false}},
+        {"VFMADD132PS",  {VecOp::RVM,   true,  1, 2, 0x98, 0,    false, false}},
+        {"VFMADD213PS",  {VecOp::RVM,   true,  1, 2, 0xA8, 0,    false, false}},
+        {"VFMADD231PS",  {VecOp::RVM,   true,  1, 2, 0xB8, 0,    false, false}},
+        {"VFMADD132PD",  {VecOp::RVM,   true,  1, 2, 0x98, 0,    true,  false}},
+        {"VFMADD213PD",  {VecOp::RVM,   true,  1, 2, 0xA8, 0,    true,  false}},
+        {"VFMADD231PD",  {VecOp::RVM,   true,  1, 2, 0xB8, 0,    true,  false}},
+    };
 }
 
-uint8_t InstructionEncoder::rex(bool w, bool r, bool x, bool b) {
+uint8_t InstructionEncoder::rex(bool w, bool r, bool x, bool b) const {
     return 0x40 | (w?0x08:0) | (r?0x04:0) | (x?0x02:0) | (b?0x01:0);
 }
-uint8_t InstructionEncoder::modrm(uint8_t mod, uint8_t reg, uint8_t rm) {
+uint8_t InstructionEncoder::modrm(uint8_t mod, uint8_t reg, uint8_t rm) const {
     return (uint8_t)(((mod&0x3)<<6) | ((reg&0x7)<<3) | (rm&0x7));
 }
-uint8_t InstructionEncoder::sib(uint8_t scale, uint8_t index, uint8_t base) {
+uint8_t InstructionEncoder::sib(uint8_t scale, uint8_t index, uint8_t base) const {
     return (uint8_t)(((scale&0x3)<<6) | ((index&0x7)<<3) | (base&0x7));
 }
 
@@ -26,9 +54,138 @@ void InstructionEncoder::writeLE(std::vector<uint8_t>& out, uint64_t value, size
     for (size_t i=0;i<bytes;i++) out.push_back((uint8_t)((value >> (i*8)) & 0xFF));
 }
 
+// Immediate text as the parser produces it: an optional '-', then decimal or 0x hex.
+// Returns the two's-complement value truncated to `bytes`; anything that fits
+// neither the signed nor the unsigned range of that width is an error.
+static uint64_t parseImmediate(const std::string& text, size_t bytes) {
+    bool neg = !text.empty() && text[0] == '-';
+    std::string digits = text.substr(neg ? 1 : 0);
+    uint64_t mag = 0;
+    try {
+        // stoull accepts a sign of its own ("-5" wraps), so only digits may follow ours
+        if (digits.empty() || digits[0] == '-' || digits[0] == '+') throw std::invalid_argument(text);
+        bool hex = digits.size()>1 && digits[0]=='0' && (digits[1]=='x' || digits[1]=='X');
+        mag = std::stoull(digits, nullptr, hex ? 16 : 10);
+    } catch (const std::logic_error&) {
+        throw std::runtime_error("Number out of range: " + text);
+    }
+    uint64_t maxUnsigned = bytes >= 8 ? UINT64_MAX : (1ull << (bytes * 8)) - 1;
+    uint64_t maxNegated = 1ull << (bytes * 8 - 1);
+    if (neg ? mag > maxNegated : mag > maxUnsigned) throw std::runtime_error("Number out of range: " + text);
+    return neg ? (uint64_t)0 - mag : mag;
+}
+
+// Memory operand forms: [base + index*scale + disp], [index*scale + disp32],
+// [disp32], and RIP-relative [label + disp] / [RIP + label + disp] (mod=00 rm=101 disp32,
+// relative to the label) or [RIP + disp] (disp32 taken as written).
+InstructionEncoder::MemRef InstructionEncoder::resolveMem(const ParsedOperand& mem) const {
+    MemRef r;
+    r.ripRel = mem.symbol || (mem.base && *mem.base == "RIP");
+    if (mem.base && !r.ripRel) {
+        auto itb = reg64.find(*mem.base);
+        if (itb==reg64.end()) throw std::runtime_error("Unknown base register: " + *mem.base);
+        r.base = itb->second; r.hasBase=true;
+    }
+    if (mem.index) {
+        if (r.ripRel) throw std::runtime_error("RIP-relative operand cannot have an index register");
+        auto iti = reg64.find(*mem.index);
+        if (iti==reg64.end()) throw std::runtime_error("Unknown index register: " + *mem.index);
+        r.index = iti->second; r.hasIndex=true;
+        if (r.index == 4) throw std::runtime_error("RSP cannot be an index register");
+    }
+    if (mem.base && *mem.base != "RIP" && mem.symbol) throw std::runtime_error("Label operand only supported RIP-relative");
+    switch (mem.scale) {
+        case 1: r.scaleBits = 0; break;
+        case 2: r.scaleBits = 1; break;
+        case 4: r.scaleBits = 2; break;
+        case 8: r.scaleBits = 3; break;
+        default: throw std::runtime_error("Invalid scale: " + std::to_string(mem.scale));
+    }
+    return r;
+}
+
+// ModRM/SIB/disp after the opcode. immBytes is the size of any immediate the
+// caller appends afterwards; the rel field of RIP-relative forms is measured
+// from the end of the whole instruction.
+void InstructionEncoder::emitMemModRM(Encoded& out, uint8_t reg, const MemRef& r, const ParsedOperand& mem, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, size_t immBytes) const {
+    if (r.ripRel) {
+        out.bytes.push_back(modrm(0, reg & 0x7, 5));
+        if (!mem.symbol) {
+            // [RIP + disp]: the displacement is already relative to the next instruction
+            if (mem.disp < INT32_MIN || mem.disp > INT32_MAX) throw std::runtime_error("Displacement does not fit in 32 bits");
+            writeLE(out.bytes, (uint64_t)mem.disp, 4);
+            return;
+        }
+        auto it = labels.find(*mem.symbol);
+        if (it==labels.end()) throw std::runtime_error("Unknown label in memory operand: " + *mem.symbol);
+        int64_t target = (int64_t)it->second + mem.disp;
+        int64_t rel = target - (int64_t)(addr + out.bytes.size() + 4 + immBytes);
+        if (rel < INT32_MIN || rel > INT32_MAX) throw std::runtime_error("RIP-relative displacement out of range");
+        out.relOffset = (int)out.bytes.size();
+        writeLE(out.bytes, (uint64_t)rel, 4);
+        return;
+    }
+
+    if (mem.disp < INT32_MIN || mem.disp > INT32_MAX) throw std::runtime_error("Displacement does not fit in 32 bits");
+    if (!r.hasBase) {
+        // no base: SIB with base=101 and mod=00 means [index*scale + disp32] (index=100: none)
+        out.bytes.push_back(modrm(0, reg & 0x7, 4));
+        out.bytes.push_back(sib(r.scaleBits, r.index & 0x7, 5));
+        writeLE(out.bytes, (uint64_t)mem.disp, 4);
+        return;
+    }
+
+    // mod=00 with base RBP/R13 means RIP/disp32, so those always carry a displacement
+    uint8_t mod;
+    if (mem.disp==0 && (r.base & 0x7) != 5) mod = 0;
+    else if (mem.disp >= -128 && mem.disp <= 127) mod = 1;
+    else mod = 2;
+
+    // rm=100 selects a SIB byte, needed for an index or an RSP/R12 base
+    if (r.hasIndex || (r.base & 0x7) == 4) {
+        out.bytes.push_back(modrm(mod, reg & 0x7, 4));
+        out.bytes.push_back(sib(r.scaleBits, r.index & 0x7, r.base & 0x7));
+    } else {
+        out.bytes.push_back(modrm(mod, reg & 0x7, r.base & 0x7));
+    }
+    if (mod == 1) writeLE(out.bytes, (uint64_t)mem.disp, 1);
+    else if (mod == 2) writeLE(out.bytes, (uint64_t)mem.disp, 4);
+}
+
+// REX.W + opcode + ModRM/SIB/disp for a 64-bit op with a memory operand.
+void InstructionEncoder::encodeMemOp(Encoded& out, uint8_t opcode, uint8_t reg, const ParsedOperand& mem, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, size_t immBytes) const {
+    MemRef r = resolveMem(mem);
+    out.bytes.push_back(rex(true, (reg & 0x08)!=0, (r.index & 0x08)!=0, r.hasBase && (r.base & 0x08)!=0));
+    out.bytes.push_back(opcode);
+    emitMemModRM(out, reg, r, mem, labels, addr, immBytes);
+}
+
+// Memory forms shared by ADD/SUB/CMP: r64, [mem] | [mem], r64 | [mem], imm32
+// opLoad: op r64, r/m64   opStore: op r/m64, r64   ext: /digit for the 0x81 imm32 form
+bool InstructionEncoder::encodeALUMem(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, uint8_t opLoad, uint8_t opStore, uint8_t ext) const {
+    auto &a = instr.operands[0];
+    auto &b = instr.operands[1];
+    if (a.kind==ParsedOperand::REG && b.kind==ParsedOperand::MEM) {
+        auto ita = reg64.find(a.text); if (ita==reg64.end()) throw std::runtime_error("Unknown reg");
+        encodeMemOp(out, opLoad, ita->second, b, labels, addr, 0);
+        return true;
+    }
+    if (a.kind==ParsedOperand::MEM && b.kind==ParsedOperand::REG) {
+        auto itb = reg64.find(b.text); if (itb==reg64.end()) throw std::runtime_error("Unknown reg");
+        encodeMemOp(out, opStore, itb->second, a, labels, addr, 0);
+        return true;
+    }
+    if (a.kind==ParsedOperand::MEM && b.kind==ParsedOperand::IMM) {
+        encodeMemOp(out, 0x81, ext, a, labels, addr, 4);
+        writeLE(out.bytes, parseImmediate(b.text, 4), 4);
+        return true;
+    }
+    return false;
+}
+
 // Simplifying assumptions: immediate fits into 32-bit for rel32, mem addressing limited.
 // encode MOV with forms: MOV reg, reg | MOV reg, imm | MOV reg, [mem] | MOV [mem], reg
-void InstructionEncoder::encodeMOV(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) {
+void InstructionEncoder::encodeMOV(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const {
     // basic checks
     if (instr.operands.size() != 2) throw std::runtime_error("MOV requires 2 operands");
 
@@ -47,10 +204,7 @@ void InstructionEncoder::encodeMOV(const ParsedInstruction& instr, Encoded& out,
         uint8_t opcode = 0xB8 + (reg & 0x7);
         out.bytes.push_back(opcode);
         // immediate: in x86-64 MOV r64, imm64 is 8 byte immediate
-        uint64_t imm = 0;
-        if (src.text.size()>1 && src.text[0]=='0' && (src.text[1]=='x' || src.text[1]=='X')) imm = std::stoull(src.text, nullptr, 16);
-        else imm = std::stoull(src.text, nullptr, 10);
-        writeLE(out.bytes, imm, 8);
+        writeLE(out.bytes, parseImmediate(src.text, 8), 8);
         return;
     }
 
@@ -73,126 +227,23 @@ void InstructionEncoder::encodeMOV(const ParsedInstruction& instr, Encoded& out,
     if (dst.kind==ParsedOperand::REG && src.kind==ParsedOperand::MEM) {
         auto itd = reg64.find(dst.text);
         if (itd==reg64.end()) throw std::runtime_error("Unknown register");
-        uint8_t rd = itd->second;
-        // Determine base/index
-        uint8_t base=4, index=4; bool hasBase=false, hasIndex=false;
-        if (src.base) {
-            auto itb = reg64.find(*src.base);
-            if (itb==reg64.end()) throw std::runtime_error("Unknown base register: " + *src.base);
-            base = itb->second; hasBase=true;
-        }
-        if (src.index) {
-            auto iti = reg64.find(*src.index);
-            if (iti==reg64.end()) throw std::runtime_error("Unknown index register: " + *src.index);
-            index = iti->second; hasIndex=true;
-        }
-        bool rexW = true;
-        bool rexR = (rd & 0x08);
-        bool rexX = hasIndex ? ((index & 0x08)!=0) : false;
-        bool rexB = hasBase ? ((base & 0x08)!=0) : false;
-        out.bytes.push_back(rex(rexW, rexR, rexX, rexB));
-        out.bytes.push_back(0x8B); // MOV r64, r/m64
-        // Basic ModR/M handling for common cases: [base + disp], [disp32], [base + index*scale + disp]
-        if (hasBase) {
-            // no SIB and no disp (disp==0) and base != RSP
-            if (!hasIndex && src.disp==0 && (base & 0x7) != 4) {
-                out.bytes.push_back(modrm(0, rd & 0x7, base & 0x7));
-            } else {
-                // need SIB or displacement. Use mod=0/1/2 depending on disp
-                if ((base & 0x7) == 4) { // base is RSP -> need SIB always
-                    // simple: use mod=0 with SIB base=RSP => special case requires disp32 or disp8 depending
-                    if (src.disp==0) {
-                        out.bytes.push_back(modrm(0, rd & 0x7, 4));
-                        out.bytes.push_back(sib((uint8_t) (std::log2(src.scale)?1:0), index & 0x7, base & 0x7)); // scale guess
-                        // but using log2 is unsafe; for simplicity assume scale 1 => scale bits 0
-                    } else if (src.disp >= -128 && src.disp <= 127) {
-                        out.bytes.push_back(modrm(1, rd & 0x7, 4));
-                        out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)src.disp, 1);
-                    } else {
-                        out.bytes.push_back(modrm(2, rd & 0x7, 4));
-                        out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)src.disp, 4);
-                    }
-                } else {
-                    // base != RSP
-                    if (src.disp==0 && !hasIndex) {
-                        out.bytes.push_back(modrm(0, rd & 0x7, base & 0x7));
-                    } else if (src.disp >= -128 && src.disp <= 127) {
-                        out.bytes.push_back(modrm(1, rd & 0x7, base & 0x7));
-                        if (hasIndex) out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)src.disp, 1);
-                    } else {
-                        out.bytes.push_back(modrm(2, rd & 0x7, base & 0x7));
-                        if (hasIndex) out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)src.disp, 4);
-                    }
-                }
-            }
-            return;
-        } else {
-            // no base -> absolute addressing not supported here
-            throw std::runtime_error("Memory operand without base not supported in this minimal encoder");
-        }
+        encodeMemOp(out, 0x8B, itd->second, src, labels, addr, 0);
+        return;
     }
 
     // MOV [mem], reg -> opcode 0x89 /r
     if (dst.kind==ParsedOperand::MEM && src.kind==ParsedOperand::REG) {
         auto its = reg64.find(src.text);
         if (its==reg64.end()) throw std::runtime_error("Unknown register");
-        uint8_t rs = its->second;
-        // handle base/index similar to above
-        uint8_t base=4, index=4; bool hasBase=false, hasIndex=false;
-        if (dst.base) { auto itb = reg64.find(*dst.base); if (itb==reg64.end()) throw std::runtime_error("Unknown base"); base = itb->second; hasBase=true;}
-        if (dst.index) { auto iti = reg64.find(*dst.index); if (iti==reg64.end()) throw std::runtime_error("Unknown index"); index = iti->second; hasIndex=true;}
-        bool rexW = true;
-        bool rexR = (rs & 0x08);
-        bool rexX = hasIndex ? ((index & 0x08)!=0) : false;
-        bool rexB = hasBase ? ((base & 0x08)!=0) : false;
-        out.bytes.push_back(rex(rexW, rexR, rexX, rexB));
-        out.bytes.push_back(0x89); // MOV r/m64, r64
-        if (hasBase) {
-            if (!hasIndex && dst.disp==0 && (base & 0x7) != 4) {
-                out.bytes.push_back(modrm(0, rs & 0x7, base & 0x7));
-            } else {
-                if ((base & 0x7) == 4) {
-                    if (dst.disp==0) {
-                        out.bytes.push_back(modrm(0, rs & 0x7, 4));
-                        out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                    } else if (dst.disp >= -128 && dst.disp <=127) {
-                        out.bytes.push_back(modrm(1, rs & 0x7, 4));
-                        out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)dst.disp, 1);
-                    } else {
-                        out.bytes.push_back(modrm(2, rs & 0x7, 4));
-                        out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)dst.disp, 4);
-                    }
-                } else {
-                    if (dst.disp==0 && !hasIndex) {
-                        out.bytes.push_back(modrm(0, rs & 0x7, base & 0x7));
-                    } else if (dst.disp >= -128 && dst.disp <=127) {
-                        out.bytes.push_back(modrm(1, rs & 0x7, base & 0x7));
-                        if (hasIndex) out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)dst.disp, 1);
-                    } else {
-                        out.bytes.push_back(modrm(2, rs & 0x7, base & 0x7));
-                        if (hasIndex) out.bytes.push_back(sib(0, index & 0x7, base & 0x7));
-                        writeLE(out.bytes, (uint64_t)(int64_t)dst.disp, 4);
-                    }
-                }
-            }
-            return;
-        } else {
-            throw std::runtime_error("Memory operand without base not supported");
-        }
+        encodeMemOp(out, 0x89, its->second, dst, labels, addr, 0);
+        return;
     }
 
     throw std::runtime_error("MOV form not supported in this minimal encoder");
 }
 
-// ADD reg, reg or reg, imm (simplified)
-void InstructionEncoder::encodeADD(const ParsedInstruction& instr, Encoded& out) {
+// ADD reg, reg or reg, imm (simplified), plus the shared memory forms
+void InstructionEncoder::encodeADD(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const {
     if (instr.operands.size() != 2) throw std::runtime_error("ADD requires 2 operands");
     auto &a = instr.operands[0];
     auto &b = instr.operands[1];
@@ -213,16 +264,15 @@ void InstructionEncoder::encodeADD(const ParsedInstruction& instr, Encoded& out)
         out.bytes.push_back(rex(true, false, false, (ra&8)!=0));
         out.bytes.push_back(0x81);
         out.bytes.push_back(modrm(3, 0, ra&7));
-        uint64_t imm = 0;
-        if (b.text.size()>1 && b.text[0]=='0' && (b.text[1]=='x' || b.text[1]=='X')) imm = std::stoull(b.text, nullptr, 16);
-        else imm = std::stoull(b.text, nullptr, 10);
+        uint64_t imm = parseImmediate(b.text, 4);
         writeLE(out.bytes, imm, 4); // imm32
         return;
     }
+    if (encodeALUMem(instr, out, labels, addr, 0x03, 0x01, 0)) return;
     throw std::runtime_error("ADD form not supported");
 }
 
-void InstructionEncoder::encodeSUB(const ParsedInstruction& instr, Encoded& out) {
+void InstructionEncoder::encodeSUB(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const {
     if (instr.operands.size() != 2) throw std::runtime_error("SUB requires 2 operands");
     auto &a = instr.operands[0];
     auto &b = instr.operands[1];
@@ -241,17 +291,16 @@ void InstructionEncoder::encodeSUB(const ParsedInstruction& instr, Encoded& out)
         out.bytes.push_back(rex(true, false, false, (ra&8)!=0));
         out.bytes.push_back(0x81);
         out.bytes.push_back(modrm(3, 5, ra&7)); // /5 is SUB
-        uint64_t imm = 0;
-        if (b.text.size()>1 && b.text[0]=='0' && (b.text[1]=='x' || b.text[1]=='X')) imm = std::stoull(b.text, nullptr, 16);
-        else imm = std::stoull(b.text, nullptr, 10);
+        uint64_t imm = parseImmediate(b.text, 4);
         writeLE(out.bytes, imm, 4);
         return;
     }
+    if (encodeALUMem(instr, out, labels, addr, 0x2B, 0x29, 5)) return;
     throw std::runtime_error("SUB form not supported");
 }
 
 // JMP label -> E9 rel32
-void InstructionEncoder::encodeJMP(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) {
+void InstructionEncoder::encodeJMP(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const {
     if (instr.operands.size()!=1) throw std::runtime_error("JMP requires one operand");
     if (instr.operands[0].kind != ParsedOperand::LABEL) throw std::runtime_error("JMP requires label");
     auto it = labels.find(instr.operands[0].text);
@@ -260,11 +309,12 @@ void InstructionEncoder::encodeJMP(const ParsedInstruction& instr, Encoded& out,
     // rel32 = target - (addr + 5)
     int64_t rel = (int64_t)target - (int64_t)(addr + 5);
     out.bytes.push_back(0xE9);
+    out.relOffset = (int)out.bytes.size();
     writeLE(out.bytes, (uint64_t)(int64_t)rel, 4);
 }
 
-// CMP reg, imm or reg, reg (we implement reg, imm)
-void InstructionEncoder::encodeCMP(const ParsedInstruction& instr, Encoded& out) {
+// CMP reg, imm (plus the shared memory forms)
+void InstructionEncoder::encodeCMP(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const {
     if (instr.operands.size()!=2) throw std::runtime_error("CMP requires 2 operands");
     auto &a = instr.operands[0]; auto &b = instr.operands[1];
     if (a.kind==ParsedOperand::REG && b.kind==ParsedOperand::IMM) {
@@ -274,30 +324,31 @@ void InstructionEncoder::encodeCMP(const ParsedInstruction& instr, Encoded& out)
         out.bytes.push_back(rex(true, false, false, (ra&8)!=0));
         out.bytes.push_back(0x81);
         out.bytes.push_back(modrm(3, 7, ra&7));
-        uint64_t imm = 0;
-        if (b.text.size()>1 && b.text[0]=='0' && (b.text[1]=='x' || b.text[1]=='X')) imm = std::stoull(b.text, nullptr, 16);
-        else imm = std::stoull(b.text, nullptr, 10);
+        uint64_t imm = parseImmediate(b.text, 4);
         writeLE(out.bytes, imm, 4);
         return;
     }
+    if (encodeALUMem(instr, out, labels, addr, 0x3B, 0x39, 7)) return;
     throw std::runtime_error("CMP form not supported");
 }
 
-// JE rel32 -> 0x0F 0x84 rel32
-void InstructionEncoder::encodeJE(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) {
-    if (instr.operands.size()!=1) throw std::runtime_error("JE requires one operand");
-    if (instr.operands[0].kind!=ParsedOperand::LABEL) throw std::runtime_error("JE needs label");
+// JE rel32 -> 0x0F 0x84 rel32, JNE rel32 -> 0x0F 0x85 rel32
+void InstructionEncoder::encodeJcc(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr, uint8_t cc) const {
+    const std::string &m = instr.mnemonic;
+    if (instr.operands.size()!=1) throw std::runtime_error(m + " requires one operand");
+    if (instr.operands[0].kind!=ParsedOperand::LABEL) throw std::runtime_error(m + " needs label");
     auto it = labels.find(instr.operands[0].text);
-    if (it==labels.end()) throw std::runtime_error("Unknown label in JE");
+    if (it==labels.end()) throw std::runtime_error("Unknown label in " + m);
     uint64_t target = it->second;
-    int64_t rel = (int64_t)target - (int64_t)(addr + 6); // 6 bytes: 0F 84 + rel32
+    int64_t rel = (int64_t)target - (int64_t)(addr + 6); // 6 bytes: 0F 8x + rel32
     out.bytes.push_back(0x0F);
-    out.bytes.push_back(0x84);
+    out.bytes.push_back(cc);
+    out.relOffset = (int)out.bytes.size();
     writeLE(out.bytes, (uint64_t)(int64_t)rel, 4);
 }
 
 // CALL label -> E8 rel32
-void InstructionEncoder::encodeCALL(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) {
+void InstructionEncoder::encodeCALL(const ParsedInstruction& instr, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const {
     if (instr.operands.size()!=1) throw std::runtime_error("CALL requires one operand");
     if (instr.operands[0].kind!=ParsedOperand::LABEL) throw std::runtime_error("CALL needs label");
     auto it = labels.find(instr.operands[0].text);
@@ -305,14 +356,131 @@ void InstructionEncoder::encodeCALL(const ParsedInstruction& instr, Encoded& out
     uint64_t target = it->second;
     int64_t rel = (int64_t)target - (int64_t)(addr + 5);
     out.bytes.push_back(0xE8);
+    out.relOffset = (int)out.bytes.size();
     writeLE(out.bytes, (uint64_t)(int64_t)rel, 4);
 }
 
-void InstructionEncoder::encodeRET(const ParsedInstruction& instr, Encoded& out) {
+void InstructionEncoder::encodeRET(const ParsedInstruction& instr, Encoded& out) const {
     out.bytes.push_back(0xC3);
 }
 
-Encoded InstructionEncoder::encodeInstruction(const ParsedInstruction& instr, const std::unordered_map<std::string,uint64_t>& labels, uint64_t currentAddress) {
+// VEX prefix: the 2-byte form (C5) when X, B and W are clear and the opcode is
+// in the 0F map, the 3-byte form (C4) otherwise. R, X, B and vvvv are stored inverted.
+void InstructionEncoder::vexPrefix(Encoded& out, bool r, bool x, bool b, uint8_t map, bool w, uint8_t vvvv, bool l, uint8_t pp) const {
+    uint8_t tail = (uint8_t)(((~vvvv & 0xF) << 3) | (l ? 0x04 : 0) | (pp & 0x3));
+    if (!x && !b && !w && map == 1) {
+        out.bytes.push_back(0xC5);
+        out.bytes.push_back((uint8_t)((r ? 0 : 0x80) | tail));
+        return;
+    }
+    out.bytes.push_back(0xC4);
+    out.bytes.push_back((uint8_t)((r ? 0 : 0x80) | (x ? 0 : 0x40) | (b ? 0 : 0x20) | (map & 0x1F)));
+    out.bytes.push_back((uint8_t)((w ? 0x80 : 0) | tail));
+}
+
+// SSE/AVX forms from vecOps. SSE: [66|F3|F2] [REX] 0F [38|3A] op ModRM.
+// VEX: C4/C5 prefix op ModRM; the vector length (VEX.L) follows the destination
+// (the source for MASK), and all vector operands must have that width except the
+// XMM source of a broadcast.
+void InstructionEncoder::encodeVector(const ParsedInstruction& instr, const VecOp& op, Encoded& out, const std::unordered_map<std::string,uint64_t>& labels, uint64_t addr) const {
+    const std::string &m = instr.mnemonic;
+    const auto &ops = instr.operands;
+    size_t want = op.form == VecOp::RVM ? 3 : 2;
+    if (ops.size() != want) throw std::runtime_error(m + " requires " + std::to_string(want) + " operands");
+
+    auto isVec = [&](const ParsedOperand& o) { return o.kind==ParsedOperand::REG && vecReg.count(o.text); };
+    auto isYmm = [](const ParsedOperand& o) { return o.text[0] == 'Y'; };
+
+    // the vector operand that sets the width
+    const ParsedOperand &sized = op.form == VecOp::MASK ? ops[1] : (ops[0].kind==ParsedOperand::MEM ? ops[1] : ops[0]);
+    if (!isVec(sized)) throw std::runtime_error(m + " needs an XMM/YMM register, got " + sized.text);
+    bool l = isYmm(sized);
+    if (l && !op.vex) throw std::runtime_error(m + " is SSE and only takes XMM registers");
+    if (!l && op.ymmOnly) throw std::runtime_error(m + " requires YMM registers");
+
+    // ModRM.reg, VEX.vvvv and the r/m operand
+    uint8_t opcode = op.opcode, reg = 0, vvvv = 0;
+    const ParsedOperand *rm = nullptr;
+    auto vec = [&](const ParsedOperand& o, bool sameWidth) -> uint8_t {
+        if (!isVec(o)) throw std::runtime_error(m + " expects an XMM/YMM register, got " + (o.text.empty() ? "memory" : o.text));
+        if (sameWidth && isYmm(o) != l) throw std::runtime_error(m + " operands must all be XMM or all be YMM");
+        return vecReg.at(o.text);
+    };
+    auto vecOrMem = [&](const ParsedOperand& o, bool sameWidth) {
+        if (o.kind != ParsedOperand::MEM) vec(o, sameWidth);
+        return &o;
+    };
+    switch (op.form) {
+    case VecOp::MOVE:
+        if (ops[0].kind==ParsedOperand::MEM) {
+            opcode = op.storeOpcode;
+            reg = vec(ops[1], true);
+            rm = &ops[0];
+        } else {
+            reg = vec(ops[0], true);
+            rm = vecOrMem(ops[1], true);
+            // reg-reg: use the store opcode when that lets a VEX prefix drop to 2 bytes (as GNU as does)
+            if (op.vex && rm->kind==ParsedOperand::REG && (vecReg.at(rm->text) & 8) && !(reg & 8)) {
+                opcode = op.storeOpcode;
+                rm = &ops[0];
+                reg = vecReg.at(ops[1].text);
+            }
+        }
+        break;
+    case VecOp::RM:
+        reg = vec(ops[0], true);
+        rm = vecOrMem(ops[1], true);
+        break;
+    case VecOp::RVM:
+        reg = vec(ops[0], true);
+        vvvv = vec(ops[1], true);
+        rm = vecOrMem(ops[2], true);
+        break;
+    case VecOp::MASK: {
+        if (ops[0].kind != ParsedOperand::REG) throw std::runtime_error(m + " needs a general-purpose destination register");
+        auto it = reg64.find(ops[0].text);
+        if (it==reg64.end()) throw std::runtime_error("Unknown register: " + ops[0].text);
+        reg = it->second;
+        vec(ops[1], true);
+        rm = &ops[1];
+        break;
+    }
+    case VecOp::BCAST:
+        reg = vec(ops[0], true);
+        rm = vecOrMem(ops[1], false);
+        if (rm->kind==ParsedOperand::REG && isYmm(*rm)) throw std::runtime_error(m + " source register must be XMM");
+        break;
+    }
+
+    MemRef ref;
+    uint8_t rmReg = 0;
+    bool x = false, b = false;
+    if (rm->kind==ParsedOperand::MEM) {
+        ref = resolveMem(*rm);
+        x = (ref.index & 8) != 0;
+        b = ref.hasBase && (ref.base & 8) != 0;
+    } else {
+        rmReg = vecReg.at(rm->text);
+        b = (rmReg & 8) != 0;
+    }
+    bool r = (reg & 8) != 0;
+
+    if (op.vex) {
+        vexPrefix(out, r, x, b, op.map, op.w, vvvv, l, op.pp);
+    } else {
+        static const uint8_t legacy[] = { 0, 0x66, 0xF3, 0xF2 };
+        if (op.pp) out.bytes.push_back(legacy[op.pp]);
+        if (r || x || b) out.bytes.push_back(rex(false, r, x, b));
+        out.bytes.push_back(0x0F);
+        if (op.map == 2) out.bytes.push_back(0x38);
+        else if (op.map == 3) out.bytes.push_back(0x3A);
+    }
+    out.bytes.push_back(opcode);
+    if (rm->kind==ParsedOperand::MEM) emitMemModRM(out, reg, ref, *rm, labels, addr, 0);
+    else out.bytes.push_back(modrm(3, reg & 7, rmReg & 7));
+}
+
+Encoded InstructionEncoder::encodeInstruction(const ParsedInstruction& instr, const std::unordered_map<std::string,uint64_t>& labels, uint64_t currentAddress) const {
     Encoded e;
     
     // If mnemonic is empty (e.g., label-only line), return empty encoding
@@ -322,13 +490,29 @@ Encoded InstructionEncoder::encodeInstruction(const ParsedInstruction& instr, co
     
     std::string m = instr.mnemonic;
     if (m=="MOV") encodeMOV(instr, e, labels, currentAddress);
-    else if (m=="ADD") encodeADD(instr, e);
-    else if (m=="SUB") encodeSUB(instr, e);
+    else if (m=="ADD") encodeADD(instr, e, labels, currentAddress);
+    else if (m=="SUB") encodeSUB(instr, e, labels, currentAddress);
     else if (m=="JMP") encodeJMP(instr, e, labels, currentAddress);
-    else if (m=="CMP") encodeCMP(instr, e);
-    else if (m=="JE") encodeJE(instr, e, labels, currentAddress);
+    else if (m=="CMP") encodeCMP(instr, e, labels, currentAddress);
+    else if (m=="JE") encodeJcc(instr, e, labels, currentAddress, 0x84);
+    else if (m=="JNE") encodeJcc(instr, e, labels, currentAddress, 0x85);
     else if (m=="CALL") encodeCALL(instr, e, labels, currentAddress);
     else if (m=="RET") encodeRET(instr, e);
-    else throw std::runtime_error("Unsupported mnemonic: " + m);
+    else {
+        auto it = vecOps.find(m);
+        if (it==vecOps.end()) throw std::runtime_error("Unsupported mnemonic: " + m);
+        encodeVector(instr, it->second, e, labels, currentAddress);
+    }
     return e;
 }
+
+
+size_t InstructionEncoder::instructionSize(const ParsedInstruction& instr) const {
+    // every referenced label resolves to 0: only the value of rel fields changes, never their size
+    std::unordered_map<std::string,uint64_t> placeholders;
+    for (auto &op : instr.operands) {
+        if (op.kind == ParsedOperand::LABEL) placeholders[op.text] = 0;
+        if (op.symbol) placeholders[*op.symbol] = 0;
+    }
+    return encodeInstruction(instr, placeholders, 0).bytes.size();
+}
@@ -2,7 +2,7 @@
 #include <cctype>
 #include <algorithm>
 
-Lexer::Lexer(const std::string& s) : src(s), pos(0) {}
+Lexer::Lexer(const std::string& s, size_t firstLine) : src(s), pos(0), line(firstLine) {}
 
 char Lexer::peek() const { return pos < src.size() ? src[pos] : '\0'; }
 char Lexer::get() { return pos < src.size() ? src[pos++] : '\0'; }
@@ -30,7 +30,11 @@ Token Lexer::identifierOrRegister() {
         "RAX","RCX","RDX","RBX","RSP","RBP","RSI","RDI",
         "R8","R9","R10","R11","R12","R13","R14","R15",
         "EAX","ECX","EDX","EBX","ESP","EBP","ESI","EDI",
-        "AX","BX","CX","DX","SI","DI","SP","BP"
+        "AX","BX","CX","DX","SI","DI","SP","BP",
+        "XMM0","XMM1","XMM2","XMM3","XMM4","XMM5","XMM6","XMM7",
+        "XMM8","XMM9","XMM10","XMM11","XMM12","XMM13","XMM14","XMM15",
+        "YMM0","YMM1","YMM2","YMM3","YMM4","YMM5","YMM6","YMM7",
+        "YMM8","YMM9","YMM10","YMM11","YMM12","YMM13","YMM14","YMM15"
     };
 
     for (auto &r : regs) if (up == r) return { Token::Type::IDENT, up };
@@ -51,6 +55,13 @@ Token Lexer::numberToken() {
 }
 
 Token Lexer::nextToken() {
+    Token t = scanToken();
+    t.line = line;
+    if (t.type == Token::EOL) ++line;
+    return t;
+}
+
+Token Lexer::scanToken() {
     if (pos >= src.size()) return { Token::Type::END, "" };
     skipSpaces();
     char c = peek();
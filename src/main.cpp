@@ -1,127 +1,215 @@
 #include <iostream>
-#include <fstream>
-#include <sstream>
+#include <string>
 #include <vector>
-#include <unordered_map>
-#include <limits>
-#include <iomanip>
-#include "lexer.hpp"
-#include "parser.hpp"
+#include <thread>
+#include <cstring>
+#include "analyzer.hpp"
+#include "assembler.hpp"
+#include "batch.hpp"
+#include "client.hpp"
 #include "encoder.hpp"
+#include "profile.hpp"
+#include "server.hpp"
+
+static void usage() {
+    std::cerr << "usage: rae [--profile FILE] [--cache] [--stats] [input [output]]\n"
+              << "       rae --batch [-j N] [--cache] [--stats] [--manifest FILE] [input output]...\n"
+              << "       rae --analyze [--march NAME] input [output]\n"
+              << "       rae --serve SOCKET [-j N] [--cache]\n"
+              << "       rae --client SOCKET input [output]\n"
+              << "       rae --loadgen SOCKET input [-c CONNECTIONS] [-n REQUESTS]\n";
+}
 
-int main(int argc, char** argv) {
-    std::string infile = "../test.rae";
-    std::string outfile = "out.bin";
-    if (argc >= 2) infile = argv[1];
-    if (argc >= 3) outfile = argv[2];
-
-    std::ifstream in(infile);
-    if (!in) { std::cerr << "Failed to open " << infile << "\n"; return 1; }
-    std::stringstream ss; ss << in.rdbuf();
-    std::string src = ss.str();
-
-    Lexer lex(src);
-    Parser parser(lex);
-    auto parsed = parser.parseAll();
+// positive decimal count for -j/-c/-n; false on anything else
+static bool parseCount(const std::string& text, unsigned long long& out) {
+    if (text.empty() || text.size() > 18) return false;
+    for (char c : text) if (c < '0' || c > '9') return false;
+    out = std::stoull(text);
+    return out > 0;
+}
 
-    // Two-pass: compute addresses
-    InstructionEncoder encoder;
-    std::unordered_map<std::string,uint64_t> labels;
-    uint64_t addr = 0;
-    
-    // pass 1: assign label addresses by estimating instruction sizes conservatively
-    for (auto &pi : parsed) {
-        if (pi.label) {
-            labels[*pi.label] = addr;
+static int runBatchMode(int argc, char** argv) {
+    BatchOptions opts;
+    opts.threads = std::thread::hardware_concurrency();
+    std::vector<BatchJob> jobs;
+    std::vector<std::string> loose;
+    for (int i = 2; i < argc; i++) {
+        std::string a = argv[i];
+        if ((a == "-j" || a == "--manifest") && i + 1 >= argc) { usage(); return 2; }
+        unsigned long long n = 0;
+        if (a == "-j" || (a.rfind("-j", 0) == 0 && a.size() > 2)) {
+            if (!parseCount(a == "-j" ? argv[++i] : a.substr(2), n) || n > 4096) { usage(); return 2; }
+            opts.threads = (unsigned)n;
         }
-        if (!pi.mnemonic.empty()) {
+        else if (a == "--cache") opts.useCache = true;
+        else if (a == "--stats") opts.stats = true;
+        else if (a == "--manifest") {
             try {
-                Encoded e = encoder.encodeInstruction(pi, labels, addr);
-            } catch (...) {
-                std::string m = pi.mnemonic;
-                if (m=="JMP" || m=="CALL") addr += 5;
-                else if (m=="JE") addr += 6;
-                else if (m=="RET") addr += 1;
-                else addr += 1;
-                continue;
+                auto m = readManifest(argv[++i]);
+                jobs.insert(jobs.end(), m.begin(), m.end());
+            } catch (const std::exception& ex) {
+                std::cerr << ex.what() << "\n";
+                return 1;
             }
-            addr += 1; // conservative minimal estimate
         }
+        else loose.push_back(a);
     }
+    if (loose.size() % 2 != 0) { usage(); return 2; }
+    for (size_t i = 0; i < loose.size(); i += 2) jobs.push_back({ loose[i], loose[i+1] });
+    if (jobs.empty()) { usage(); return 2; }
+    return runBatch(jobs, opts, std::cerr) == 0 ? 0 : 1;
+}
 
-    // Debug: print labels resolved in pass1
-    std::cerr << "Pass1: assigned " << labels.size() << " labels:\n";
-    for (auto &kv : labels) std::cerr << "  " << kv.first << " -> " << kv.second << "\n";
-
-    // pass 2: actual encoding with resolved labels (instrumented)
-    std::vector<uint8_t> outBytes;
-    addr = 0;
-    size_t accum = 0; // diagnostic accumulator
-    const size_t HARD_LIMIT = 100ull * 1024 * 1024; // 100 MiB for diagnostic abort
-    for (size_t idx = 0; idx < parsed.size(); ++idx) {
-        auto &pi = parsed[idx];
-        if (pi.label) labels[*pi.label] = addr;
-        if (!pi.mnemonic.empty()) {
-            try {
-                Encoded e = encoder.encodeInstruction(pi, labels, addr);
-                std::cerr << "instr[" << idx << "] line=" << pi.sourceLine
-                          << " mnemonic=" << pi.mnemonic
-                          << " bytes=" << e.bytes.size()
-                          << " addr=" << addr << "\n";
-
-                if (e.bytes.size() > 1024*1024) {
-                    std::cerr << "ERROR: single instruction produced >1MiB bytes at line "
-                              << pi.sourceLine << " mnemonic=" << pi.mnemonic << "\n";
-                    return 1;
-                }
+static int runServeMode(int argc, char** argv) {
+    if (argc < 3) { usage(); return 2; }
+    unsigned threads = std::thread::hardware_concurrency();
+    bool useCache = false;
+    for (int i = 3; i < argc; i++) {
+        std::string a = argv[i];
+        unsigned long long n = 0;
+        if (a == "-j" && i + 1 < argc) {
+            if (!parseCount(argv[++i], n) || n > 4096) { usage(); return 2; }
+            threads = (unsigned)n;
+        } else if (a.rfind("-j", 0) == 0 && a.size() > 2) {
+            if (!parseCount(a.substr(2), n) || n > 4096) { usage(); return 2; }
+            threads = (unsigned)n;
+        } else if (a == "--cache") {
+            useCache = true;
+        } else { usage(); return 2; }
+    }
+    return runServer(argv[2], threads, useCache, std::cerr);
+}
 
-                outBytes.insert(outBytes.end(), e.bytes.begin(), e.bytes.end());
-                accum += e.bytes.size();            // update diagnostic accumulator
-                addr += e.bytes.size();
+static int runClientMode(int argc, char** argv) {
+    if (argc < 4 || argc > 5) { usage(); return 2; }
+    rae_proto::Request req;
+    if (!readFile(argv[3], req.source)) { std::cerr << "Failed to open " << argv[3] << "\n"; return 1; }
+    std::string outfile = argc == 5 ? argv[4] : "out.bin";
+    try {
+        AssemblerClient client(argv[2]);
+        rae_proto::Response resp = client.assemble(req);
+        for (auto &d : resp.diagnostics) std::cerr << argv[3] << ": " << d << "\n";
+        if (!resp.ok) return 1;
+        for (auto &s : resp.symbols) std::cerr << "  " << s.first << " -> " << s.second << "\n";
+        if (!writeFile(outfile, resp.bytes)) { std::cerr << "Failed to write output file " << outfile << "\n"; return 1; }
+        std::cout << "Wrote " << resp.bytes.size() << " bytes to " << outfile << "\n";
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
 
-                if (outBytes.size() != accum) {
-                    std::cerr << "DIAG: mismatch after instr[" << idx << "]: outBytes.size()="
-                              << outBytes.size() << " accum=" << accum << "\n";
-                    // dump a few bytes to help identify corruption
-                    size_t dumpN = std::min<size_t>(32, outBytes.size());
-                    std::cerr << "first " << dumpN << " bytes:";
-                    for (size_t i=0;i<dumpN;i++) std::cerr << " " << std::hex << (int)outBytes[i];
-                    std::cerr << std::dec << "\n";
-                    return 1;
-                }
+static int runLoadGenMode(int argc, char** argv) {
+    if (argc < 4) { usage(); return 2; }
+    unsigned connections = 8;
+    size_t requests = 1000;
+    for (int i = 4; i < argc; i++) {
+        std::string a = argv[i];
+        unsigned long long n = 0;
+        if (a == "-c" && i + 1 < argc) {
+            if (!parseCount(argv[++i], n) || n > 4096) { usage(); return 2; }
+            connections = (unsigned)n;
+        } else if (a == "-n" && i + 1 < argc) {
+            if (!parseCount(argv[++i], n)) { usage(); return 2; }
+            requests = (size_t)n;
+        } else { usage(); return 2; }
+    }
+    std::string src;
+    if (!readFile(argv[3], src)) { std::cerr << "Failed to open " << argv[3] << "\n"; return 1; }
+    return runLoadGenerator(argv[2], src, connections, requests, std::cout) == 0 ? 0 : 1;
+}
 
-                if (outBytes.size() > HARD_LIMIT) {
-                    std::cerr << "ABORT: accumulated output exceeded " << HARD_LIMIT
-                              << " bytes after instr[" << idx << "] (total=" << outBytes.size() << ")\n";
-                    return 1;
-                }
-            } catch (const std::exception& ex) {
-                std::cerr << "Encoding error at instr[" << idx << "] line " << pi.sourceLine
-                          << ": " << ex.what() << "\n";
-                return 1;
-            }
-        }
+static int runAnalyzeMode(int argc, char** argv) {
+    std::string march = "skylake";
+    std::vector<std::string> positional;
+    for (int i = 2; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "--march" && i + 1 < argc) march = argv[++i];
+        else positional.push_back(a);
     }
+    if (positional.empty() || positional.size() > 2) { usage(); return 2; }
 
-    std::cerr << "Final accum=" << accum << " outBytes.size()=" << outBytes.size() << "\n";
+    std::string src;
+    if (!readFile(positional[0], src)) { std::cerr << "Failed to open " << positional[0] << "\n"; return 1; }
+    InstructionEncoder encoder;
+    Assembler assembler(encoder);
+    assembler.keepListing = true;
+    AssemblyResult res = assembler.assemble(src);
+    if (!res.ok) {
+        for (auto &e : res.errors) std::cerr << positional[0] << ": " << e << "\n";
+        return 1;
+    }
+    if (positional.size() == 2 && !writeFile(positional[1], res.bytes)) {
+        std::cerr << "Failed to write output file " << positional[1] << "\n";
+        return 1;
+    }
+    try {
+        analyzeListing(res.listing, march, std::cout);
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << " (known:";
+        for (auto &n : analyzerMicroarchs()) std::cerr << " " << n;
+        std::cerr << ")\n";
+        return 2;
+    }
+    return 0;
+}
 
-    // write out using the diagnostic accumulator (accum) as authoritative size
-    std::ofstream of(outfile, std::ios::binary);
-    if (!of) { std::cerr << "Failed to open output file\n"; return 1; }
+int main(int argc, char** argv) {
+    if (argc >= 2 && std::strcmp(argv[1], "--batch") == 0) return runBatchMode(argc, argv);
+    if (argc >= 2 && std::strcmp(argv[1], "--analyze") == 0) return runAnalyzeMode(argc, argv);
+    if (argc >= 2 && std::strcmp(argv[1], "--serve") == 0) return runServeMode(argc, argv);
+    if (argc >= 2 && std::strcmp(argv[1], "--client") == 0) return runClientMode(argc, argv);
+    if (argc >= 2 && std::strcmp(argv[1], "--loadgen") == 0) return runLoadGenMode(argc, argv);
 
-    if (accum != outBytes.size()) {
-        std::cerr << "WARNING: accum != outBytes.size(), using accum (" << accum << ") for write\n";
+    std::string infile = "../test.rae";
+    std::string outfile = "out.bin";
+    std::string profileFile;
+    bool useCache = false;
+    bool stats = false;
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--profile") == 0) {
+            if (i + 1 >= argc) { usage(); return 2; }
+            profileFile = argv[++i];
+        } else if (std::strcmp(argv[i], "--cache") == 0) {
+            useCache = true;
+        } else if (std::strcmp(argv[i], "--stats") == 0) {
+            stats = true;
+        } else {
+            positional.push_back(argv[i]);
+        }
+    }
+    if (positional.size() > 2) { usage(); return 2; }
+    if (positional.size() >= 1) infile = positional[0];
+    if (positional.size() >= 2) outfile = positional[1];
+
+    Profile profile;
+    if (!profileFile.empty()) {
+        try {
+            profile = readProfile(profileFile);
+        } catch (const std::exception& ex) {
+            std::cerr << ex.what() << "\n";
+            return 1;
+        }
     }
 
-    if (accum > static_cast<size_t>(std::numeric_limits<std::streamsize>::max())) {
-        std::cerr << "Output too large to write safely\n";
+    std::string src;
+    if (!readFile(infile, src)) { std::cerr << "Failed to open " << infile << "\n"; return 1; }
+
+    InstructionEncoder encoder;
+    Assembler assembler(encoder);
+    if (!profileFile.empty()) assembler.profile = &profile;
+    assembler.useCache = useCache;
+    assembler.timeCache = stats;
+    AssemblyResult res = assembler.assemble(src, nullptr, &std::cerr);
+    if (!res.ok) {
+        for (auto &e : res.errors) std::cerr << infile << ": " << e << "\n";
         return 1;
     }
 
-    std::streamsize toWrite = static_cast<std::streamsize>(accum);
-    of.write(reinterpret_cast<const char*>(outBytes.data()), toWrite);
-    of.close();
+    if (!writeFile(outfile, res.bytes)) { std::cerr << "Failed to write output file " << outfile << "\n"; return 1; }
 
-    std::cout << "Wrote " << static_cast<unsigned long long>(accum) << " bytes to " << outfile << "\n";
+    std::cout << "Wrote " << static_cast<unsigned long long>(res.bytes.size()) << " bytes to " << outfile << "\n";
     return 0;
 }
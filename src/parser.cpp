@@ -11,11 +11,42 @@ void Parser::next() {
     cur = lexer.nextToken();
 }
 
+static bool isRegister(const std::string& name) {
+    static const std::unordered_set<std::string> registers = {
+        "RAX","RCX","RDX","RBX","RSP","RBP","RSI","RDI",
+        "R8","R9","R10","R11","R12","R13","R14","R15",
+        "EAX","ECX","EDX","EBX","ESP","EBP","ESI","EDI",
+        "AX","BX","CX","DX","SI","DI","SP","BP",
+        "XMM0","XMM1","XMM2","XMM3","XMM4","XMM5","XMM6","XMM7",
+        "XMM8","XMM9","XMM10","XMM11","XMM12","XMM13","XMM14","XMM15",
+        "YMM0","YMM1","YMM2","YMM3","YMM4","YMM5","YMM6","YMM7",
+        "YMM8","YMM9","YMM10","YMM11","YMM12","YMM13","YMM14","YMM15"
+    };
+    return registers.find(name) != registers.end();
+}
+
+static std::string describe(const Token& t) {
+    if (t.type == Token::EOL) return "end of line";
+    if (t.type == Token::END) return "end of input";
+    return "'" + t.text + "'";
+}
+
 int64_t Parser::parseNumberText(const std::string& s) {
-    if (s.size() > 1 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
-        return std::stoll(s, nullptr, 16);
+    try {
+        if (s.size() > 1 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+            return std::stoll(s, nullptr, 16);
+        }
+        return std::stoll(s, nullptr, 10);
+    } catch (const std::logic_error&) {
+        throw std::runtime_error("Number out of range: " + s);
     }
-    return std::stoll(s, nullptr, 10);
+}
+
+void Parser::parseScale(ParsedOperand& op) {
+    next(); // '*'
+    if (cur.type != Token::NUMBER) throw std::runtime_error("Expected scale after '*', got " + describe(cur));
+    op.scale = (int)parseNumberText(cur.text);
+    next();
 }
 
 ParsedOperand Parser::parseOperand() {
@@ -23,14 +54,29 @@ ParsedOperand Parser::parseOperand() {
     op.kind = ParsedOperand::IMM;
     op.text = "";
 
-    // Handle memory operands: [base + index*scale + disp]
+    // Handle memory operands: [base + index*scale + disp], [label + disp], [RIP + label + disp],
+    // [disp] and [disp + base]. A register is the index when it has a scale or a base
+    // was already given, the base otherwise.
+    // Every iteration consumes a token and the operand ends at ']' or the end of
+    // the line, so an unterminated '[' is an error instead of a scan to EOF.
     if (cur.type == Token::LBRACKET) {
         op.kind = ParsedOperand::MEM;
         next();
 
-        // Parse base register
+        // Parse base register (or a label, which makes the operand RIP-relative)
         if (cur.type == Token::IDENT) {
-            op.base = cur.text;
+            if (isRegister(cur.text) || cur.text == "RIP") op.base = cur.text;
+            else op.symbol = cur.text;
+            next();
+            // [index*scale + disp] has no base
+            if (cur.type == Token::MUL && op.base) {
+                op.index = op.base;
+                op.base.reset();
+                parseScale(op);
+            }
+        } else if (cur.type == Token::NUMBER) {
+            // [0x1000], [16 + RAX]
+            op.disp += parseNumberText(cur.text);
             next();
         }
 
@@ -38,48 +84,52 @@ ParsedOperand Parser::parseOperand() {
         while (cur.type != Token::RBRACKET) {
             if (cur.type == Token::PLUS) {
                 next();
-                if (cur.type == Token::IDENT) {
-                    op.index = cur.text;
+                if (cur.type == Token::IDENT && !isRegister(cur.text)) {
+                    if (op.symbol) throw std::runtime_error("Only one label allowed in a memory operand");
+                    op.symbol = cur.text;
                     next();
-                    // Check for *scale
-                    if (cur.type == Token::MUL) {
-                        next();
-                        if (cur.type == Token::NUMBER) {
-                            op.scale = (int)parseNumberText(cur.text);
-                            next();
-                        }
+                } else if (cur.type == Token::IDENT) {
+                    std::string reg = cur.text;
+                    next();
+                    if (cur.type == Token::MUL || op.base) {
+                        if (op.index) throw std::runtime_error("Only one index register allowed in a memory operand");
+                        op.index = reg;
+                        if (cur.type == Token::MUL) parseScale(op);
+                    } else {
+                        op.base = reg;
                     }
                 } else if (cur.type == Token::NUMBER) {
                     op.disp += parseNumberText(cur.text);
                     next();
-                }
-            } else if (cur.type == Token::MINUS) {
-                next();
-                if (cur.type == Token::NUMBER) {
+                } else if (cur.type == Token::MINUS) {
+                    // [RSP + -8]
+                    next();
+                    if (cur.type != Token::NUMBER) throw std::runtime_error("Expected number after '-', got " + describe(cur));
                     op.disp -= parseNumberText(cur.text);
                     next();
+                } else {
+                    throw std::runtime_error("Expected register, label or number after '+', got " + describe(cur));
                 }
-            } else {
+            } else if (cur.type == Token::MINUS) {
+                next();
+                if (cur.type != Token::NUMBER) throw std::runtime_error("Expected number after '-', got " + describe(cur));
+                op.disp -= parseNumberText(cur.text);
                 next();
+            } else if (cur.type == Token::EOL || cur.type == Token::END) {
+                throw std::runtime_error("Unterminated '[' in memory operand");
+            } else {
+                throw std::runtime_error("Unexpected " + describe(cur) + " in memory operand");
             }
         }
-        if (cur.type == Token::RBRACKET) next();
+        next(); // ']'
         return op;
     }
-
     // Handle registers and labels
     if (cur.type == Token::IDENT) {
         op.text = cur.text;
         
         // Check if it's a known register
-        static const std::unordered_set<std::string> registers = {
-            "RAX","RCX","RDX","RBX","RSP","RBP","RSI","RDI",
-            "R8","R9","R10","R11","R12","R13","R14","R15",
-            "EAX","ECX","EDX","EBX","ESP","EBP","ESI","EDI",
-            "AX","BX","CX","DX","SI","DI","SP","BP"
-        };
-        
-        if (registers.find(op.text) != registers.end()) {
+        if (isRegister(op.text)) {
             op.kind = ParsedOperand::REG;
         } else {
             op.kind = ParsedOperand::LABEL;
@@ -108,70 +158,73 @@ ParsedOperand Parser::parseOperand() {
         }
     }
 
-    throw std::runtime_error("Invalid operand");
+    throw std::runtime_error("Invalid operand " + describe(cur));
 }
 
+// Parses "[label:] [mnemonic [operand [, operand]...]]" up to (not including) the
+// end of the line. Throws std::runtime_error on malformed input; parseAll()
+// recovers from that.
 ParsedInstruction Parser::parseLine() {
     ParsedInstruction instr;
     instr.sourceLine = cur.line;
 
+    if (cur.type != Token::IDENT) throw std::runtime_error("Expected label or mnemonic, got " + describe(cur));
+
     // Check for label (identifier followed by colon)
-    if (cur.type == Token::IDENT) {
-        std::string potentialLabel = cur.text;
+    std::string first = cur.text;
+    next();
+    if (cur.type == Token::COLON) {
+        // This is a label
+        instr.label = first;
+        next();
+        // After label, check if there's an instruction on the same line
+        if (cur.type == Token::EOL || cur.type == Token::END) return instr;
+        if (cur.type != Token::IDENT) throw std::runtime_error("Expected mnemonic after label, got " + describe(cur));
+        instr.mnemonic = cur.text;
         next();
-        if (cur.type == Token::COLON) {
-            // This is a label
-            instr.label = potentialLabel;
+    } else {
+        // Not a label, first is the mnemonic
+        instr.mnemonic = first;
+    }
+
+    // Parse operands; parseOperand either consumes at least one token or throws,
+    // so this loop is linear in the length of the line
+    while (cur.type != Token::EOL && cur.type != Token::END) {
+        instr.operands.push_back(parseOperand());
+        if (cur.type == Token::COMMA) {
             next();
-            // After label, check if there's an instruction on the same line
-            if (cur.type == Token::IDENT) {
-                instr.mnemonic = cur.text;
-                next();
-                // Parse operands
-                while (cur.type != Token::EOL && cur.type != Token::END) {
-                    instr.operands.push_back(parseOperand());
-                    if (cur.type == Token::COMMA) {
-                        next();
-                    }
-                }
-            }
-            // If no instruction after label, mnemonic stays empty
-            return instr;
-        } else {
-            // Not a label, potentialLabel is the mnemonic
-            instr.mnemonic = potentialLabel;
-            // Parse operands
-            while (cur.type != Token::EOL && cur.type != Token::END) {
-                instr.operands.push_back(parseOperand());
-                if (cur.type == Token::COMMA) {
-                    next();
-                }
-            }
-            return instr;
+            if (cur.type == Token::EOL || cur.type == Token::END) throw std::runtime_error("Expected operand after ','");
         }
     }
-
-    // If we get here with no identifier, skip to next line
     return instr;
 }
 
+void Parser::syncToEOL() {
+    while (cur.type != Token::EOL && cur.type != Token::END) next();
+}
+
 std::vector<ParsedInstruction> Parser::parseAll() {
     std::vector<ParsedInstruction> result;
-    
+
     while (cur.type != Token::END) {
         if (cur.type == Token::EOL) {
             next();
             continue;
         }
-        
-        ParsedInstruction instr = parseLine();
-        result.push_back(instr);
-        
-        // Skip to next line
-        if (cur.type == Token::EOL) {
-            next();
+
+        size_t line = cur.line;
+        try {
+            result.push_back(parseLine());
+        } catch (const std::exception& ex) {
+            // report, then resync at the next line so one bad line yields one diagnostic
+            diags.push_back("line " + std::to_string(line) + ": " + ex.what());
+            syncToEOL();
+            if (diags.size() >= maxErrors) {
+                diags.push_back("too many errors, giving up");
+                break;
+            }
         }
     }
-    
+
     return result;
-}
\ No newline at end of file
+}
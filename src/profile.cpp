@@ -0,0 +1,248 @@
+#include "profile.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+static std::string toUpper(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c){ return std::toupper(c); });
+    return s;
+}
+
+Profile readProfile(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Failed to open profile " + path);
+    Profile prof;
+    std::string line;
+    size_t lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        std::istringstream ls(line);
+        std::vector<std::string> f;
+        for (std::string w; ls >> w; ) f.push_back(w);
+        if (f.empty()) continue;
+        try {
+            if (f.size() == 2) {
+                prof.blockCounts[toUpper(f[0])] += std::stoull(f[1]);
+                continue;
+            }
+            if (f.size() == 4 && f[1] == "->") {
+                prof.edgeCounts[toUpper(f[0])][toUpper(f[2])] += std::stoull(f[3]);
+                continue;
+            }
+        } catch (const std::logic_error&) {
+            // bad count, reported below
+        }
+        throw std::runtime_error(path + ":" + std::to_string(lineNo) + ": expected \"LABEL COUNT\" or \"FROM -> TO COUNT\"");
+    }
+    return prof;
+}
+
+namespace {
+
+struct Block {
+    enum Exit { FALL, JUMP, COND, RET } exit = FALL;
+    std::vector<ParsedInstruction> instrs;
+    std::string label;  // label at the block start, empty if none
+    std::string target; // branch target label for JUMP/COND
+    int fall = -1;      // block reached by falling through (FALL/COND), -1 at the end
+    uint64_t weight = 0;
+};
+
+bool isTerminator(const std::string& m) {
+    return m=="JMP" || m=="JE" || m=="JNE" || m=="RET";
+}
+
+std::vector<Block> splitBlocks(const std::vector<ParsedInstruction>& instrs) {
+    std::vector<Block> blocks;
+    bool open = false;
+    for (auto &pi : instrs) {
+        if (!open || (pi.label && !blocks.back().instrs.empty())) {
+            blocks.emplace_back();
+            open = true;
+        }
+        Block &b = blocks.back();
+        if (b.instrs.empty() && pi.label) b.label = *pi.label;
+        b.instrs.push_back(pi);
+        if (isTerminator(pi.mnemonic)) {
+            if (pi.mnemonic == "RET") b.exit = Block::RET;
+            else b.exit = pi.mnemonic == "JMP" ? Block::JUMP : Block::COND;
+            if (pi.operands.size() == 1 && pi.operands[0].kind == ParsedOperand::LABEL) b.target = pi.operands[0].text;
+            open = false;
+        }
+    }
+    for (size_t i = 0; i < blocks.size(); i++) {
+        if ((blocks[i].exit == Block::FALL || blocks[i].exit == Block::COND) && i + 1 < blocks.size()) blocks[i].fall = (int)i + 1;
+    }
+    return blocks;
+}
+
+} // namespace
+
+std::vector<ParsedInstruction> reorderBlocks(const std::vector<ParsedInstruction>& instrs, const Profile& profile, ReorderStats* stats) {
+    std::vector<Block> blocks = splitBlocks(instrs);
+    const size_t n = blocks.size();
+    ReorderStats st;
+    st.blocks = n;
+    if (n < 2) {
+        if (stats) *stats = st;
+        return instrs;
+    }
+
+    std::unordered_map<std::string,int> blockOf;
+    std::unordered_set<std::string> usedLabels;
+    for (auto &pi : instrs) if (pi.label) usedLabels.insert(*pi.label);
+    for (size_t i = 0; i < n; i++) if (!blocks[i].label.empty()) blockOf[blocks[i].label] = (int)i;
+
+    auto edgeCount = [&](const std::string& from, const std::string& to, uint64_t& count) {
+        auto it = profile.edgeCounts.find(from);
+        if (it == profile.edgeCounts.end()) return false;
+        auto jt = it->second.find(to);
+        if (jt == it->second.end()) return false;
+        count = jt->second;
+        return true;
+    };
+
+    // labeled blocks take their profile count, unlabeled ones the count of the
+    // block before them (minus its taken-branch count when the profile has it).
+    // An unlabeled block after a JMP/RET can't be reached and stays at 0.
+    for (size_t i = 0; i < n; i++) {
+        if (!blocks[i].label.empty()) {
+            auto it = profile.blockCounts.find(blocks[i].label);
+            blocks[i].weight = it != profile.blockCounts.end() ? it->second : 0;
+        } else if (i && (blocks[i-1].exit == Block::RET || blocks[i-1].exit == Block::JUMP)) {
+            blocks[i].weight = 0;
+        } else if (i) {
+            const Block &prev = blocks[i-1];
+            uint64_t taken = 0;
+            blocks[i].weight = prev.weight;
+            if (prev.exit == Block::COND && edgeCount(prev.label, prev.target, taken)) {
+                blocks[i].weight = prev.weight > taken ? prev.weight - taken : 0;
+            }
+        }
+    }
+    auto targetOf = [&](const Block& b) {
+        auto it = blockOf.find(b.target);
+        return it != blockOf.end() ? it->second : -1;
+    };
+    auto edgeWeight = [&](int from, int to) {
+        const Block &a = blocks[from], &b = blocks[to];
+        uint64_t count = 0;
+        if (!a.label.empty() && !b.label.empty() && edgeCount(a.label, b.label, count)) return count;
+        return std::min(a.weight, b.weight);
+    };
+
+    // the entry stays first; a block that runs off the end of the code stays last
+    int pinnedLast = -1;
+    if (blocks[n-1].exit == Block::FALL || blocks[n-1].exit == Block::COND) pinnedLast = (int)n - 1;
+
+    std::vector<int> order;
+    std::vector<bool> placed(n, false);
+    auto placeable = [&](int i) { return i >= 0 && !placed[i] && i != pinnedLast; };
+
+    // grow chains along the heaviest not-yet-placed successor edge
+    auto growChain = [&](int head) {
+        for (int cur = head; cur >= 0; ) {
+            order.push_back(cur);
+            placed[cur] = true;
+            const Block &b = blocks[cur];
+            int best = -1;
+            uint64_t bestW = 0;
+            // fallthrough first so it wins ties
+            int succ[2] = { b.fall, (b.exit == Block::JUMP || b.exit == Block::COND) ? targetOf(b) : -1 };
+            for (int s : succ) {
+                if (!placeable(s) || blocks[s].weight == 0) continue;
+                uint64_t w = edgeWeight(cur, s);
+                if (w > bestW) { best = s; bestW = w; }
+            }
+            cur = best;
+        }
+    };
+    growChain(0);
+    for (;;) {
+        int next = -1;
+        for (size_t i = 0; i < n; i++) {
+            if (placeable((int)i) && blocks[i].weight > 0 && (next < 0 || blocks[i].weight > blocks[next].weight)) next = (int)i;
+        }
+        if (next < 0) break;
+        growChain(next);
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (placeable((int)i)) { order.push_back((int)i); placed[i] = true; st.coldBlocks++; }
+    }
+    if (pinnedLast > 0) order.push_back(pinnedLast);
+
+    // give a block a label so it can become a branch target
+    auto labelOf = [&](int i) -> const std::string& {
+        Block &b = blocks[i];
+        if (b.label.empty()) {
+            std::string name;
+            for (size_t k = i; ; k++) {
+                name = "PGO_BLOCK_" + std::to_string(k);
+                if (usedLabels.insert(name).second) break;
+            }
+            ParsedInstruction lbl;
+            lbl.label = name;
+            lbl.sourceLine = b.instrs.front().sourceLine;
+            b.instrs.insert(b.instrs.begin(), lbl);
+            b.label = name;
+        }
+        return b.label;
+    };
+    auto makeJmp = [](const std::string& target, size_t line) {
+        ParsedInstruction j;
+        j.mnemonic = "JMP";
+        ParsedOperand op;
+        op.kind = ParsedOperand::LABEL;
+        op.text = target;
+        j.operands.push_back(op);
+        j.sourceLine = line;
+        return j;
+    };
+
+    // rewrite block exits for the new order
+    for (size_t p = 0; p < order.size(); p++) {
+        Block &b = blocks[order[p]];
+        int next = p + 1 < order.size() ? order[p+1] : -1;
+        ParsedInstruction &last = b.instrs.back();
+        switch (b.exit) {
+        case Block::RET:
+            break;
+        case Block::FALL:
+            if (b.fall >= 0 && b.fall != next) {
+                b.instrs.push_back(makeJmp(labelOf(b.fall), last.sourceLine));
+                st.addedJumps++;
+            }
+            break;
+        case Block::JUMP:
+            if (next >= 0 && targetOf(b) == next) {
+                // keep a label that sat on the JMP line
+                if (last.label && b.instrs.size() == 1) { last.mnemonic.clear(); last.operands.clear(); }
+                else b.instrs.pop_back();
+                st.removedJumps++;
+            }
+            break;
+        case Block::COND:
+            if (b.fall < 0 || b.fall == next) break;
+            if (next >= 0 && targetOf(b) == next) {
+                last.mnemonic = last.mnemonic == "JE" ? "JNE" : "JE";
+                last.operands[0].text = labelOf(b.fall);
+                st.invertedBranches++;
+            } else {
+                b.instrs.push_back(makeJmp(labelOf(b.fall), last.sourceLine));
+                st.addedJumps++;
+            }
+            break;
+        }
+    }
+
+    std::vector<ParsedInstruction> out;
+    out.reserve(instrs.size() + st.addedJumps + n);
+    for (int i : order) out.insert(out.end(), blocks[i].instrs.begin(), blocks[i].instrs.end());
+    if (stats) *stats = st;
+    return out;
+}
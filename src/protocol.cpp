@@ -0,0 +1,132 @@
+#include "protocol.hpp"
+#include "encoder.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace rae_proto {
+
+namespace {
+
+class Reader {
+public:
+    explicit Reader(const std::vector<uint8_t>& b) : buf(b) {}
+    uint64_t le(size_t n) {
+        need(n);
+        uint64_t v = 0;
+        for (size_t i = 0; i < n; i++) v |= (uint64_t)buf[pos + i] << (i * 8);
+        pos += n;
+        return v;
+    }
+    std::string str(size_t n) {
+        need(n);
+        std::string s(reinterpret_cast<const char*>(buf.data()) + pos, n);
+        pos += n;
+        return s;
+    }
+    void bytes(size_t n, std::vector<uint8_t>& out) {
+        need(n);
+        out.assign(buf.begin() + pos, buf.begin() + pos + n);
+        pos += n;
+    }
+    size_t remaining() const { return buf.size() - pos; }
+private:
+    const std::vector<uint8_t>& buf;
+    size_t pos = 0;
+    void need(size_t n) { if (n > buf.size() - pos) throw std::runtime_error("Truncated message"); }
+};
+
+void putString(std::vector<uint8_t>& out, const std::string& s, size_t lenBytes) {
+    InstructionEncoder::writeLE(out, s.size(), lenBytes);
+    out.insert(out.end(), s.begin(), s.end());
+}
+
+void readAll(int fd, uint8_t* p, size_t n) {
+    while (n > 0) {
+        ssize_t r = ::read(fd, p, n);
+        if (r < 0 && errno == EINTR) continue;
+        if (r < 0) throw std::runtime_error(std::string("read: ") + std::strerror(errno));
+        if (r == 0) throw std::runtime_error("Connection closed mid-frame");
+        p += r; n -= (size_t)r;
+    }
+}
+
+void writeAll(int fd, const uint8_t* p, size_t n) {
+    while (n > 0) {
+        ssize_t w = ::send(fd, p, n, MSG_NOSIGNAL);
+        if (w < 0 && errno == EINTR) continue;
+        if (w < 0) throw std::runtime_error(std::string("write: ") + std::strerror(errno));
+        p += w; n -= (size_t)w;
+    }
+}
+
+} // namespace
+
+void encodeRequest(const Request& req, std::vector<uint8_t>& out) {
+    out.clear();
+    InstructionEncoder::writeLE(out, req.flags, 4);
+    InstructionEncoder::writeLE(out, req.baseAddress, 8);
+    out.insert(out.end(), req.source.begin(), req.source.end());
+}
+
+void decodeRequest(const std::vector<uint8_t>& payload, Request& req) {
+    Reader r(payload);
+    req.flags = (uint32_t)r.le(4);
+    req.baseAddress = r.le(8);
+    req.source = r.str(r.remaining());
+}
+
+void encodeResponse(const Response& resp, std::vector<uint8_t>& out) {
+    out.clear();
+    out.push_back(resp.ok ? 0 : 1);
+    InstructionEncoder::writeLE(out, resp.bytes.size(), 4);
+    out.insert(out.end(), resp.bytes.begin(), resp.bytes.end());
+    InstructionEncoder::writeLE(out, resp.symbols.size(), 4);
+    for (auto &s : resp.symbols) {
+        putString(out, s.first, 4);
+        InstructionEncoder::writeLE(out, s.second, 8);
+    }
+    InstructionEncoder::writeLE(out, resp.diagnostics.size(), 4);
+    for (auto &d : resp.diagnostics) putString(out, d, 4);
+}
+
+void decodeResponse(const std::vector<uint8_t>& payload, Response& resp) {
+    Reader r(payload);
+    resp.ok = r.le(1) == 0;
+    r.bytes((size_t)r.le(4), resp.bytes);
+    size_t nsyms = (size_t)r.le(4);
+    resp.symbols.clear();
+    for (size_t i = 0; i < nsyms; i++) {
+        std::string name = r.str((size_t)r.le(4));
+        resp.symbols.push_back({ name, r.le(8) });
+    }
+    size_t ndiags = (size_t)r.le(4);
+    resp.diagnostics.clear();
+    for (size_t i = 0; i < ndiags; i++) resp.diagnostics.push_back(r.str((size_t)r.le(4)));
+}
+
+bool readFrame(int fd, std::vector<uint8_t>& payload) {
+    uint8_t hdr[4];
+    ssize_t r;
+    do { r = ::read(fd, hdr, 1); } while (r < 0 && errno == EINTR);
+    if (r == 0) return false;
+    if (r < 0) throw std::runtime_error(std::string("read: ") + std::strerror(errno));
+    readAll(fd, hdr + 1, 3);
+    uint32_t len = (uint32_t)hdr[0] | (uint32_t)hdr[1] << 8 | (uint32_t)hdr[2] << 16 | (uint32_t)hdr[3] << 24;
+    if (len > MAX_FRAME) throw std::runtime_error("Frame too large: " + std::to_string(len));
+    payload.resize(len);
+    readAll(fd, payload.data(), len);
+    return true;
+}
+
+void writeFrame(int fd, const std::vector<uint8_t>& payload) {
+    if (payload.size() > MAX_FRAME) throw std::runtime_error("Frame too large: " + std::to_string(payload.size()));
+    std::vector<uint8_t> hdr;
+    InstructionEncoder::writeLE(hdr, payload.size(), 4);
+    writeAll(fd, hdr.data(), hdr.size());
+    writeAll(fd, payload.data(), payload.size());
+}
+
+} // namespace rae_proto
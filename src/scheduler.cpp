@@ -0,0 +1,121 @@
+#include "scheduler.hpp"
+#include <exception>
+
+namespace {
+// which pool/worker the calling thread belongs to (null/-1 for outside threads)
+thread_local const WorkStealingPool* tlsPool = nullptr;
+thread_local int tlsWorker = -1;
+}
+
+WorkStealingPool::WorkStealingPool(unsigned threads) {
+    if (threads == 0) threads = 1;
+    for (unsigned i = 0; i < threads; i++) queues.push_back(std::make_unique<Queue>());
+    for (unsigned i = 0; i < threads; i++) workers.emplace_back([this, i] { workerLoop(i); });
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    waitIdle();
+    {
+        std::lock_guard<std::mutex> lk(sleepMutex);
+        stopping = true;
+    }
+    sleepCv.notify_all();
+    for (auto &t : workers) t.join();
+}
+
+int WorkStealingPool::currentWorker() const {
+    return tlsPool == this ? tlsWorker : -1;
+}
+
+void WorkStealingPool::submit(std::function<void()> task) {
+    int self = currentWorker();
+    // workers push onto their own deque; outside threads use the shared FIFO so
+    // that under sustained load the oldest external task is served first
+    Queue &q = self >= 0 ? *queues[self] : injected;
+    pending++;
+    {
+        std::lock_guard<std::mutex> lk(q.m);
+        q.tasks.push_back(std::move(task));
+    }
+    {
+        // publish under the sleep mutex so a worker about to wait cannot miss it
+        std::lock_guard<std::mutex> lk(sleepMutex);
+        queued++;
+    }
+    sleepCv.notify_one();
+}
+
+bool WorkStealingPool::tryRunOne(int self) {
+    std::function<void()> task;
+    size_t n = queues.size();
+    auto popFront = [&task](Queue& q) {
+        std::lock_guard<std::mutex> lk(q.m);
+        if (q.tasks.empty()) return;
+        task = std::move(q.tasks.front());
+        q.tasks.pop_front();
+    };
+    // own deque first (back), then the shared FIFO, then steal from the others (front)
+    if (self >= 0) {
+        std::lock_guard<std::mutex> lk(queues[self]->m);
+        if (!queues[self]->tasks.empty()) {
+            task = std::move(queues[self]->tasks.back());
+            queues[self]->tasks.pop_back();
+        }
+    }
+    if (!task) popFront(injected);
+    size_t start = self >= 0 ? (size_t)self + 1 : 0;
+    for (size_t k = 0; !task && k < n; k++) popFront(*queues[(start + k) % n]);
+    if (!task) return false;
+    queued--;
+    task();
+    if (--pending == 0) {
+        std::lock_guard<std::mutex> lk(sleepMutex);
+        idleCv.notify_all();
+    }
+    return true;
+}
+
+void WorkStealingPool::workerLoop(unsigned idx) {
+    tlsPool = this;
+    tlsWorker = (int)idx;
+    for (;;) {
+        if (tryRunOne((int)idx)) continue;
+        std::unique_lock<std::mutex> lk(sleepMutex);
+        sleepCv.wait(lk, [this] { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+    }
+}
+
+void WorkStealingPool::parallelFor(size_t n, const std::function<void(size_t)>& fn) {
+    if (n == 0) return;
+    std::atomic<size_t> remaining{n};
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+    auto run = [&](size_t i) {
+        try {
+            fn(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lk(errorMutex);
+            if (!firstError) firstError = std::current_exception();
+        }
+        remaining--;
+    };
+    for (size_t i = 1; i < n; i++) submit([&run, i] { run(i); });
+    run(0);
+    // help out instead of blocking: the tasks we wait on may be queued behind us
+    int self = currentWorker();
+    while (remaining > 0) {
+        if (!tryRunOne(self)) std::this_thread::yield();
+    }
+    if (firstError) std::rethrow_exception(firstError);
+}
+
+void WorkStealingPool::waitIdle() {
+    int self = currentWorker();
+    if (self >= 0) {
+        while (pending > 0) if (!tryRunOne(self)) std::this_thread::yield();
+        return;
+    }
+    std::unique_lock<std::mutex> lk(sleepMutex);
+    idleCv.wait(lk, [this] { return pending == 0; });
+}
@@ -0,0 +1,194 @@
+#include "server.hpp"
+#include "assembler.hpp"
+#include "encoder.hpp"
+#include "protocol.hpp"
+#include "scheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+int wakeWrite = -1;
+volatile std::sig_atomic_t stopRequested = 0;
+
+void onSignal(int) {
+    stopRequested = 1;
+    if (wakeWrite >= 0) { char c = 0; (void)!::write(wakeWrite, &c, 1); }
+}
+
+// cap on a worker's cache; a long-lived server sees unbounded distinct immediates
+constexpr size_t MAX_CACHE_ENTRIES = 1 << 16;
+
+// Reused per worker thread so steady-state requests don't reallocate: frame
+// buffers, the assembly result (bytes, labels, errors) and, when the assembler
+// has useCache set, an encoding cache that stays warm across requests.
+struct Arena {
+    explicit Arena(const InstructionEncoder& encoder) : cache(encoder) {}
+    std::vector<uint8_t> in, out;
+    rae_proto::Request req;
+    rae_proto::Response resp;
+    AssemblyResult result;
+    EncodingCache cache;
+};
+
+// Handles one request on `fd`. Returns false when the connection should be closed.
+bool serveOne(int fd, const Assembler& assembler, const InstructionEncoder& encoder) {
+    thread_local Arena arena(encoder);
+    if (!rae_proto::readFrame(fd, arena.in)) return false;
+
+    rae_proto::Response &resp = arena.resp;
+    resp.ok = false;
+    resp.bytes.clear();
+    resp.symbols.clear();
+    resp.diagnostics.clear();
+    try {
+        rae_proto::decodeRequest(arena.in, arena.req);
+        // serial on purpose: helping the pool from here could re-enter this
+        // thread's arena; concurrency comes from serving connections in parallel
+        if (arena.cache.size() > MAX_CACHE_ENTRIES) arena.cache.clear();
+        AssemblyResult &res = arena.result;
+        assembler.assemble(arena.req.source, res, assembler.useCache ? &arena.cache : nullptr);
+        resp.ok = res.ok;
+        // swap rather than move so both sides keep their capacity for the next request
+        resp.diagnostics.swap(res.errors);
+        if (res.ok) {
+            resp.bytes.swap(res.bytes);
+            if (arena.req.flags & rae_proto::WANT_SYMBOLS) {
+                for (auto &kv : res.labels) resp.symbols.push_back({ kv.first, kv.second + arena.req.baseAddress });
+                std::sort(resp.symbols.begin(), resp.symbols.end(),
+                          [](auto &a, auto &b) { return a.second != b.second ? a.second < b.second : a.first < b.first; });
+            }
+        }
+    } catch (const std::exception& ex) {
+        resp.ok = false;
+        resp.diagnostics.push_back(ex.what());
+    }
+    rae_proto::encodeResponse(resp, arena.out);
+    rae_proto::writeFrame(fd, arena.out);
+    return true;
+}
+
+} // namespace
+
+int runServer(const std::string& socketPath, unsigned threads, bool useCache, std::ostream& log) {
+    sockaddr_un sa{};
+    if (socketPath.size() >= sizeof(sa.sun_path)) { log << "Socket path too long: " << socketPath << "\n"; return 1; }
+    sa.sun_family = AF_UNIX;
+    std::strncpy(sa.sun_path, socketPath.c_str(), sizeof(sa.sun_path) - 1);
+
+    // only replace a stale socket: refuse if a server still answers, and never unlink a non-socket
+    struct stat st;
+    if (::lstat(socketPath.c_str(), &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) { log << socketPath << " exists and is not a socket\n"; return 1; }
+        int probe = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (probe < 0) { log << "socket: " << std::strerror(errno) << "\n"; return 1; }
+        bool live = ::connect(probe, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)) == 0;
+        ::close(probe);
+        if (live) { log << "Another server is already listening on " << socketPath << "\n"; return 1; }
+        ::unlink(socketPath.c_str());
+    }
+
+    int lfd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (lfd < 0) { log << "socket: " << std::strerror(errno) << "\n"; return 1; }
+    if (::bind(lfd, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)) < 0 || ::listen(lfd, 128) < 0) {
+        log << "bind/listen " << socketPath << ": " << std::strerror(errno) << "\n";
+        ::close(lfd);
+        return 1;
+    }
+
+    int wake[2];
+    if (::pipe2(wake, O_CLOEXEC | O_NONBLOCK) < 0) { log << "pipe: " << std::strerror(errno) << "\n"; ::close(lfd); return 1; }
+    wakeWrite = wake[1];
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    const InstructionEncoder encoder;
+    Assembler assembler(encoder);
+    assembler.useCache = useCache;
+
+    // connections handed back by workers, waiting to be polled again
+    std::mutex returnedMutex;
+    std::vector<int> returned;
+    std::vector<int> idle;
+
+    log << "Listening on " << socketPath << " with " << threads << " workers\n";
+    {
+        WorkStealingPool pool(threads);
+        std::vector<pollfd> pfds;
+        while (!stopRequested) {
+            {
+                std::lock_guard<std::mutex> lk(returnedMutex);
+                idle.insert(idle.end(), returned.begin(), returned.end());
+                returned.clear();
+            }
+            pfds.clear();
+            pfds.push_back({ wake[0], POLLIN, 0 });
+            pfds.push_back({ lfd, POLLIN, 0 });
+            for (int fd : idle) pfds.push_back({ fd, POLLIN, 0 });
+
+            if (::poll(pfds.data(), pfds.size(), -1) < 0) {
+                if (errno == EINTR) continue;
+                log << "poll: " << std::strerror(errno) << "\n";
+                break;
+            }
+            size_t polled = idle.size();
+            if (pfds[0].revents) { char drain[64]; while (::read(wake[0], drain, sizeof(drain)) > 0) {} }
+            if (pfds[1].revents & POLLIN) {
+                int cfd = ::accept4(lfd, nullptr, nullptr, SOCK_CLOEXEC);
+                if (cfd >= 0) {
+                    // a client that stalls mid-frame must not pin a worker forever
+                    timeval tv{ 30, 0 };
+                    ::setsockopt(cfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+                    idle.push_back(cfd);
+                }
+            }
+
+            // idle[0..polled) are in pfds; anything after was accepted just now
+            std::vector<int> stillIdle(idle.begin() + polled, idle.end());
+            for (size_t i = 2; i < pfds.size(); i++) {
+                int fd = pfds[i].fd;
+                if (!pfds[i].revents) { stillIdle.push_back(fd); continue; }
+                // the connection leaves the poll set while a worker owns it
+                pool.submit([fd, &assembler, &encoder, &returnedMutex, &returned] {
+                    bool keep = false;
+                    try {
+                        keep = serveOne(fd, assembler, encoder);
+                    } catch (...) {
+                        keep = false;
+                    }
+                    if (!keep) { ::close(fd); return; }
+                    {
+                        std::lock_guard<std::mutex> lk(returnedMutex);
+                        returned.push_back(fd);
+                    }
+                    char c = 0;
+                    (void)!::write(wakeWrite, &c, 1);
+                });
+            }
+            idle.swap(stillIdle);
+        }
+        pool.waitIdle();
+    }
+
+    for (int fd : idle) ::close(fd);
+    for (int fd : returned) ::close(fd);
+    ::close(lfd);
+    ::unlink(socketPath.c_str());
+    wakeWrite = -1;
+    ::close(wake[0]);
+    ::close(wake[1]);
+    log << "Server stopped\n";
+    return 0;
+}
@@ -0,0 +1,164 @@
+// Pathological parser inputs, plus immediates the encoder must encode exactly or
+// reject rather than truncate. Each case runs in its own process (see
+// tests/CMakeLists.txt) so peak RSS is per case: CTest's TIMEOUT catches hangs,
+// this driver checks the elapsed-time and memory caps and the diagnostics.
+//
+//   parser_adversarial CASE MAX_SECONDS MAX_RSS_MB
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <sys/resource.h>
+#include "assembler.hpp"
+#include "encoder.hpp"
+
+namespace {
+
+struct Case {
+    std::function<std::string()> input;
+    std::function<bool(const AssemblyResult&, std::string& why)> check;
+};
+
+bool expectErrors(const AssemblyResult& res, const std::vector<std::string>& want, std::string& why) {
+    if (res.errors == want) return true;
+    why = "expected " + std::to_string(want.size()) + " diagnostics, got " + std::to_string(res.errors.size());
+    for (size_t i = 0; i < res.errors.size() && i < 5; i++) why += "\n  " + res.errors[i].substr(0, 200);
+    return false;
+}
+
+std::string repeat(const std::string& s, size_t n) {
+    std::string out;
+    out.reserve(s.size() * n);
+    for (size_t i = 0; i < n; i++) out += s;
+    return out;
+}
+
+const std::map<std::string, Case> cases = {
+    // one 13 MB line: a single giant identifier, then a valid line
+    { "long_line", {
+        [] { return std::string(13u << 20, 'X') + "\nRET\n"; },
+        [](const AssemblyResult& r, std::string& why) {
+            if (r.errors.size() == 1 && r.errors[0].rfind("line 1: Unsupported mnemonic: XXXX", 0) == 0) return true;
+            why = "expected one 'Unsupported mnemonic' error on line 1, got " + std::to_string(r.errors.size());
+            return false;
+        } } },
+    // 3M repeated '+' in one valid operand: [RAX + 1 + 1 ...] sums to disp32 3000000
+    { "plus_chain", {
+        [] { return "ADD RAX, [RAX" + repeat(" + 1", 3000000) + "]\n"; },
+        [](const AssemblyResult& r, std::string& why) {
+            const std::vector<uint8_t> want = { 0x48, 0x03, 0x80, 0xC0, 0xC6, 0x2D, 0x00 };
+            if (r.ok && r.bytes == want) return true;
+            why = r.ok ? "wrong encoding" : r.errors[0].substr(0, 200);
+            return false;
+        } } },
+    // 3M bare '+' stop at the first one that isn't followed by an operand
+    { "plus_run", {
+        [] { return "MOV RAX, [RAX " + std::string(3000000, '+') + " 8]\n"; },
+        [](const AssemblyResult& r, std::string& why) {
+            return expectErrors(r, { "line 1: Expected register, label or number after '+', got '+'" }, why);
+        } } },
+    // 1M labels, every one a branch target
+    { "many_labels", {
+        [] {
+            std::string s;
+            for (int i = 0; i < 1000000; i++) s += "L" + std::to_string(i) + ":\n";
+            return s + "JMP L0\nJMP L999999\n";
+        },
+        [](const AssemblyResult& r, std::string& why) {
+            if (r.ok && r.labels.size() == 1000000 && r.bytes.size() == 10) return true;
+            why = r.ok ? "got " + std::to_string(r.labels.size()) + " labels" : r.errors[0];
+            return false;
+        } } },
+    // 200k stray '[' lines: one diagnostic per line up to Parser::maxErrors
+    { "stray_brackets", {
+        [] { return repeat("[\n", 200000); },
+        [](const AssemblyResult& r, std::string& why) {
+            std::vector<std::string> want;
+            for (int i = 1; i <= 100; i++) want.push_back("line " + std::to_string(i) + ": Expected label or mnemonic, got '['");
+            want.push_back("too many errors, giving up");
+            return expectErrors(r, want, why);
+        } } },
+    // unterminated brackets mid-file and at EOF without a newline; good lines in between still parse
+    { "unterminated", {
+        [] { return "MOV RAX, [RBX + 8\nMOV RAX, [RBX + 8]\nMOV [RSP, RAX\nADD RAX, ["; },
+        [](const AssemblyResult& r, std::string& why) {
+            return expectErrors(r, {
+                "line 1: Unterminated '[' in memory operand",
+                "line 3: Unexpected ',' in memory operand",
+                "line 4: Unterminated '[' in memory operand",
+            }, why);
+        } } },
+    // immediates: sign applied after the base prefix, imm32/imm64 range-checked
+    { "immediates", {
+        [] {
+            return "ADD RAX, -0x10\nMOV RBX, -0x1\nSUB RCX, -2147483648\nCMP RDX, 0xFFFFFFFF\n"
+                   "MOV RAX, 0xFFFFFFFFFFFFFFFF\nMOV RAX, -9223372036854775808\n";
+        },
+        [](const AssemblyResult& r, std::string& why) {
+            const std::vector<uint8_t> want = {
+                0x48, 0x81, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF,
+                0x48, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0x48, 0x81, 0xE9, 0x00, 0x00, 0x00, 0x80,
+                0x48, 0x81, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+                0x48, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+            };
+            if (r.ok && r.bytes == want) return true;
+            why = r.ok ? "wrong encoding" : r.errors[0];
+            return false;
+        } } },
+    { "imm_range", {
+        [] {
+            return "ADD RAX, 0x100000000\nCMP RBX, 4294967296\nADD [RAX], 0x1FFFFFFFF\nSUB RAX, -0x80000001\n"
+                   "MOV RAX, 0x10000000000000000\nMOV RAX, -9223372036854775809\n";
+        },
+        [](const AssemblyResult& r, std::string& why) {
+            return expectErrors(r, {
+                "line 1: Number out of range: 0x100000000",
+                "line 2: Number out of range: 4294967296",
+                "line 3: Number out of range: 0x1FFFFFFFF",
+                "line 4: Number out of range: -0x80000001",
+                "line 5: Number out of range: 0x10000000000000000",
+                "line 6: Number out of range: -9223372036854775809",
+            }, why);
+        } } },
+};
+
+long peakRssMB() {
+    rusage ru{};
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss / 1024; // KiB on Linux
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 4 || !cases.count(argv[1])) {
+        std::cerr << "usage: parser_adversarial CASE MAX_SECONDS MAX_RSS_MB\ncases:";
+        for (auto &kv : cases) std::cerr << " " << kv.first;
+        std::cerr << "\n";
+        return 2;
+    }
+    const Case &c = cases.at(argv[1]);
+    double maxSeconds = std::atof(argv[2]);
+    long maxRss = std::atol(argv[3]);
+
+    std::string src = c.input();
+    InstructionEncoder encoder;
+    Assembler assembler(encoder);
+    auto t0 = std::chrono::steady_clock::now();
+    AssemblyResult res = assembler.assemble(src);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    long rss = peakRssMB();
+
+    std::printf("%s: %zu bytes in, %.2f s (cap %.0f), peak RSS %ld MB (cap %ld)\n",
+                argv[1], src.size(), seconds, maxSeconds, rss, maxRss);
+    std::string why;
+    if (!c.check(res, why)) { std::printf("FAIL: %s\n", why.c_str()); return 1; }
+    if (seconds > maxSeconds) { std::printf("FAIL: over time cap\n"); return 1; }
+    if (rss > maxRss) { std::printf("FAIL: over memory cap\n"); return 1; }
+    return 0;
+}
@@ -0,0 +1,1546 @@
+# Reference for corpus.rae (same lines, GNU as syntax). Regenerate corpus.bin with:
+#   as corpus.s -o corpus.o && ld -Ttext=0 --oformat binary -o corpus.bin corpus.o
+.intel_syntax noprefix
+mov rax, [rdi]
+mov [rdi], rax
+mov rax, [r13]
+mov [r13], rax
+mov rax, [rbp]
+mov [rbp], rax
+mov rax, [r12]
+mov [r12], rax
+mov rax, [rsp+8]
+mov [rsp+8], rax
+mov rax, [rsp-8]
+mov [rsp-8], rax
+mov rax, [r12+r9*4-200]
+mov [r12+r9*4-200], rax
+mov rax, [rbp+rcx*8]
+mov [rbp+rcx*8], rax
+mov rax, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], rax
+mov rax, [rax*2+16]
+mov [rax*2+16], rax
+mov rax, [r15*8-8]
+mov [r15*8-8], rax
+mov rax, [0x1000]
+mov [0x1000], rax
+mov rax, [-8]
+mov [-8], rax
+mov rax, [rax+16]
+mov [rax+16], rax
+mov rax, [rax+rbx*4+16]
+mov [rax+rbx*4+16], rax
+mov rax, [r8*8+0x100]
+mov [r8*8+0x100], rax
+mov rax, [rbx+rax*2]
+mov [rbx+rax*2], rax
+mov rax, [rbx+rcx]
+mov [rbx+rcx], rax
+mov rax, [rip+data]
+mov [rip+data], rax
+mov rax, [rip+data+4]
+mov [rip+data+4], rax
+mov rax, [rip+data-4]
+mov [rip+data-4], rax
+mov rax, [rip+16]
+mov [rip+16], rax
+mov rax, [rip-0x100]
+mov [rip-0x100], rax
+mov rcx, [rdi]
+mov [rdi], rcx
+mov rcx, [r13]
+mov [r13], rcx
+mov rcx, [rbp]
+mov [rbp], rcx
+mov rcx, [r12]
+mov [r12], rcx
+mov rcx, [rsp+8]
+mov [rsp+8], rcx
+mov rcx, [rsp-8]
+mov [rsp-8], rcx
+mov rcx, [r12+r9*4-200]
+mov [r12+r9*4-200], rcx
+mov rcx, [rbp+rcx*8]
+mov [rbp+rcx*8], rcx
+mov rcx, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], rcx
+mov rcx, [rax*2+16]
+mov [rax*2+16], rcx
+mov rcx, [r15*8-8]
+mov [r15*8-8], rcx
+mov rcx, [0x1000]
+mov [0x1000], rcx
+mov rcx, [-8]
+mov [-8], rcx
+mov rcx, [rax+16]
+mov [rax+16], rcx
+mov rcx, [rax+rbx*4+16]
+mov [rax+rbx*4+16], rcx
+mov rcx, [r8*8+0x100]
+mov [r8*8+0x100], rcx
+mov rcx, [rbx+rax*2]
+mov [rbx+rax*2], rcx
+mov rcx, [rbx+rcx]
+mov [rbx+rcx], rcx
+mov rcx, [rip+data]
+mov [rip+data], rcx
+mov rcx, [rip+data+4]
+mov [rip+data+4], rcx
+mov rcx, [rip+data-4]
+mov [rip+data-4], rcx
+mov rcx, [rip+16]
+mov [rip+16], rcx
+mov rcx, [rip-0x100]
+mov [rip-0x100], rcx
+mov rsp, [rdi]
+mov [rdi], rsp
+mov rsp, [r13]
+mov [r13], rsp
+mov rsp, [rbp]
+mov [rbp], rsp
+mov rsp, [r12]
+mov [r12], rsp
+mov rsp, [rsp+8]
+mov [rsp+8], rsp
+mov rsp, [rsp-8]
+mov [rsp-8], rsp
+mov rsp, [r12+r9*4-200]
+mov [r12+r9*4-200], rsp
+mov rsp, [rbp+rcx*8]
+mov [rbp+rcx*8], rsp
+mov rsp, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], rsp
+mov rsp, [rax*2+16]
+mov [rax*2+16], rsp
+mov rsp, [r15*8-8]
+mov [r15*8-8], rsp
+mov rsp, [0x1000]
+mov [0x1000], rsp
+mov rsp, [-8]
+mov [-8], rsp
+mov rsp, [rax+16]
+mov [rax+16], rsp
+mov rsp, [rax+rbx*4+16]
+mov [rax+rbx*4+16], rsp
+mov rsp, [r8*8+0x100]
+mov [r8*8+0x100], rsp
+mov rsp, [rbx+rax*2]
+mov [rbx+rax*2], rsp
+mov rsp, [rbx+rcx]
+mov [rbx+rcx], rsp
+mov rsp, [rip+data]
+mov [rip+data], rsp
+mov rsp, [rip+data+4]
+mov [rip+data+4], rsp
+mov rsp, [rip+data-4]
+mov [rip+data-4], rsp
+mov rsp, [rip+16]
+mov [rip+16], rsp
+mov rsp, [rip-0x100]
+mov [rip-0x100], rsp
+mov rbp, [rdi]
+mov [rdi], rbp
+mov rbp, [r13]
+mov [r13], rbp
+mov rbp, [rbp]
+mov [rbp], rbp
+mov rbp, [r12]
+mov [r12], rbp
+mov rbp, [rsp+8]
+mov [rsp+8], rbp
+mov rbp, [rsp-8]
+mov [rsp-8], rbp
+mov rbp, [r12+r9*4-200]
+mov [r12+r9*4-200], rbp
+mov rbp, [rbp+rcx*8]
+mov [rbp+rcx*8], rbp
+mov rbp, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], rbp
+mov rbp, [rax*2+16]
+mov [rax*2+16], rbp
+mov rbp, [r15*8-8]
+mov [r15*8-8], rbp
+mov rbp, [0x1000]
+mov [0x1000], rbp
+mov rbp, [-8]
+mov [-8], rbp
+mov rbp, [rax+16]
+mov [rax+16], rbp
+mov rbp, [rax+rbx*4+16]
+mov [rax+rbx*4+16], rbp
+mov rbp, [r8*8+0x100]
+mov [r8*8+0x100], rbp
+mov rbp, [rbx+rax*2]
+mov [rbx+rax*2], rbp
+mov rbp, [rbx+rcx]
+mov [rbx+rcx], rbp
+mov rbp, [rip+data]
+mov [rip+data], rbp
+mov rbp, [rip+data+4]
+mov [rip+data+4], rbp
+mov rbp, [rip+data-4]
+mov [rip+data-4], rbp
+mov rbp, [rip+16]
+mov [rip+16], rbp
+mov rbp, [rip-0x100]
+mov [rip-0x100], rbp
+mov r8, [rdi]
+mov [rdi], r8
+mov r8, [r13]
+mov [r13], r8
+mov r8, [rbp]
+mov [rbp], r8
+mov r8, [r12]
+mov [r12], r8
+mov r8, [rsp+8]
+mov [rsp+8], r8
+mov r8, [rsp-8]
+mov [rsp-8], r8
+mov r8, [r12+r9*4-200]
+mov [r12+r9*4-200], r8
+mov r8, [rbp+rcx*8]
+mov [rbp+rcx*8], r8
+mov r8, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], r8
+mov r8, [rax*2+16]
+mov [rax*2+16], r8
+mov r8, [r15*8-8]
+mov [r15*8-8], r8
+mov r8, [0x1000]
+mov [0x1000], r8
+mov r8, [-8]
+mov [-8], r8
+mov r8, [rax+16]
+mov [rax+16], r8
+mov r8, [rax+rbx*4+16]
+mov [rax+rbx*4+16], r8
+mov r8, [r8*8+0x100]
+mov [r8*8+0x100], r8
+mov r8, [rbx+rax*2]
+mov [rbx+rax*2], r8
+mov r8, [rbx+rcx]
+mov [rbx+rcx], r8
+mov r8, [rip+data]
+mov [rip+data], r8
+mov r8, [rip+data+4]
+mov [rip+data+4], r8
+mov r8, [rip+data-4]
+mov [rip+data-4], r8
+mov r8, [rip+16]
+mov [rip+16], r8
+mov r8, [rip-0x100]
+mov [rip-0x100], r8
+mov r12, [rdi]
+mov [rdi], r12
+mov r12, [r13]
+mov [r13], r12
+mov r12, [rbp]
+mov [rbp], r12
+mov r12, [r12]
+mov [r12], r12
+mov r12, [rsp+8]
+mov [rsp+8], r12
+mov r12, [rsp-8]
+mov [rsp-8], r12
+mov r12, [r12+r9*4-200]
+mov [r12+r9*4-200], r12
+mov r12, [rbp+rcx*8]
+mov [rbp+rcx*8], r12
+mov r12, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], r12
+mov r12, [rax*2+16]
+mov [rax*2+16], r12
+mov r12, [r15*8-8]
+mov [r15*8-8], r12
+mov r12, [0x1000]
+mov [0x1000], r12
+mov r12, [-8]
+mov [-8], r12
+mov r12, [rax+16]
+mov [rax+16], r12
+mov r12, [rax+rbx*4+16]
+mov [rax+rbx*4+16], r12
+mov r12, [r8*8+0x100]
+mov [r8*8+0x100], r12
+mov r12, [rbx+rax*2]
+mov [rbx+rax*2], r12
+mov r12, [rbx+rcx]
+mov [rbx+rcx], r12
+mov r12, [rip+data]
+mov [rip+data], r12
+mov r12, [rip+data+4]
+mov [rip+data+4], r12
+mov r12, [rip+data-4]
+mov [rip+data-4], r12
+mov r12, [rip+16]
+mov [rip+16], r12
+mov r12, [rip-0x100]
+mov [rip-0x100], r12
+mov r13, [rdi]
+mov [rdi], r13
+mov r13, [r13]
+mov [r13], r13
+mov r13, [rbp]
+mov [rbp], r13
+mov r13, [r12]
+mov [r12], r13
+mov r13, [rsp+8]
+mov [rsp+8], r13
+mov r13, [rsp-8]
+mov [rsp-8], r13
+mov r13, [r12+r9*4-200]
+mov [r12+r9*4-200], r13
+mov r13, [rbp+rcx*8]
+mov [rbp+rcx*8], r13
+mov r13, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], r13
+mov r13, [rax*2+16]
+mov [rax*2+16], r13
+mov r13, [r15*8-8]
+mov [r15*8-8], r13
+mov r13, [0x1000]
+mov [0x1000], r13
+mov r13, [-8]
+mov [-8], r13
+mov r13, [rax+16]
+mov [rax+16], r13
+mov r13, [rax+rbx*4+16]
+mov [rax+rbx*4+16], r13
+mov r13, [r8*8+0x100]
+mov [r8*8+0x100], r13
+mov r13, [rbx+rax*2]
+mov [rbx+rax*2], r13
+mov r13, [rbx+rcx]
+mov [rbx+rcx], r13
+mov r13, [rip+data]
+mov [rip+data], r13
+mov r13, [rip+data+4]
+mov [rip+data+4], r13
+mov r13, [rip+data-4]
+mov [rip+data-4], r13
+mov r13, [rip+16]
+mov [rip+16], r13
+mov r13, [rip-0x100]
+mov [rip-0x100], r13
+mov r15, [rdi]
+mov [rdi], r15
+mov r15, [r13]
+mov [r13], r15
+mov r15, [rbp]
+mov [rbp], r15
+mov r15, [r12]
+mov [r12], r15
+mov r15, [rsp+8]
+mov [rsp+8], r15
+mov r15, [rsp-8]
+mov [rsp-8], r15
+mov r15, [r12+r9*4-200]
+mov [r12+r9*4-200], r15
+mov r15, [rbp+rcx*8]
+mov [rbp+rcx*8], r15
+mov r15, [r13+r14*2+0x1000]
+mov [r13+r14*2+0x1000], r15
+mov r15, [rax*2+16]
+mov [rax*2+16], r15
+mov r15, [r15*8-8]
+mov [r15*8-8], r15
+mov r15, [0x1000]
+mov [0x1000], r15
+mov r15, [-8]
+mov [-8], r15
+mov r15, [rax+16]
+mov [rax+16], r15
+mov r15, [rax+rbx*4+16]
+mov [rax+rbx*4+16], r15
+mov r15, [r8*8+0x100]
+mov [r8*8+0x100], r15
+mov r15, [rbx+rax*2]
+mov [rbx+rax*2], r15
+mov r15, [rbx+rcx]
+mov [rbx+rcx], r15
+mov r15, [rip+data]
+mov [rip+data], r15
+mov r15, [rip+data+4]
+mov [rip+data+4], r15
+mov r15, [rip+data-4]
+mov [rip+data-4], r15
+mov r15, [rip+16]
+mov [rip+16], r15
+mov r15, [rip-0x100]
+mov [rip-0x100], r15
+add rax, [rdi]
+add [rdi], rax
+add rax, [r13]
+add [r13], rax
+add rax, [rbp]
+add [rbp], rax
+add rax, [r12]
+add [r12], rax
+add rax, [rsp+8]
+add [rsp+8], rax
+add rax, [rsp-8]
+add [rsp-8], rax
+add rax, [r12+r9*4-200]
+add [r12+r9*4-200], rax
+add rax, [rbp+rcx*8]
+add [rbp+rcx*8], rax
+add rax, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], rax
+add rax, [rax*2+16]
+add [rax*2+16], rax
+add rax, [r15*8-8]
+add [r15*8-8], rax
+add rax, [0x1000]
+add [0x1000], rax
+add rax, [-8]
+add [-8], rax
+add rax, [rax+16]
+add [rax+16], rax
+add rax, [rax+rbx*4+16]
+add [rax+rbx*4+16], rax
+add rax, [r8*8+0x100]
+add [r8*8+0x100], rax
+add rax, [rbx+rax*2]
+add [rbx+rax*2], rax
+add rax, [rbx+rcx]
+add [rbx+rcx], rax
+add rax, [rip+data]
+add [rip+data], rax
+add rax, [rip+data+4]
+add [rip+data+4], rax
+add rax, [rip+data-4]
+add [rip+data-4], rax
+add rax, [rip+16]
+add [rip+16], rax
+add rax, [rip-0x100]
+add [rip-0x100], rax
+add rcx, [rdi]
+add [rdi], rcx
+add rcx, [r13]
+add [r13], rcx
+add rcx, [rbp]
+add [rbp], rcx
+add rcx, [r12]
+add [r12], rcx
+add rcx, [rsp+8]
+add [rsp+8], rcx
+add rcx, [rsp-8]
+add [rsp-8], rcx
+add rcx, [r12+r9*4-200]
+add [r12+r9*4-200], rcx
+add rcx, [rbp+rcx*8]
+add [rbp+rcx*8], rcx
+add rcx, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], rcx
+add rcx, [rax*2+16]
+add [rax*2+16], rcx
+add rcx, [r15*8-8]
+add [r15*8-8], rcx
+add rcx, [0x1000]
+add [0x1000], rcx
+add rcx, [-8]
+add [-8], rcx
+add rcx, [rax+16]
+add [rax+16], rcx
+add rcx, [rax+rbx*4+16]
+add [rax+rbx*4+16], rcx
+add rcx, [r8*8+0x100]
+add [r8*8+0x100], rcx
+add rcx, [rbx+rax*2]
+add [rbx+rax*2], rcx
+add rcx, [rbx+rcx]
+add [rbx+rcx], rcx
+add rcx, [rip+data]
+add [rip+data], rcx
+add rcx, [rip+data+4]
+add [rip+data+4], rcx
+add rcx, [rip+data-4]
+add [rip+data-4], rcx
+add rcx, [rip+16]
+add [rip+16], rcx
+add rcx, [rip-0x100]
+add [rip-0x100], rcx
+add rsp, [rdi]
+add [rdi], rsp
+add rsp, [r13]
+add [r13], rsp
+add rsp, [rbp]
+add [rbp], rsp
+add rsp, [r12]
+add [r12], rsp
+add rsp, [rsp+8]
+add [rsp+8], rsp
+add rsp, [rsp-8]
+add [rsp-8], rsp
+add rsp, [r12+r9*4-200]
+add [r12+r9*4-200], rsp
+add rsp, [rbp+rcx*8]
+add [rbp+rcx*8], rsp
+add rsp, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], rsp
+add rsp, [rax*2+16]
+add [rax*2+16], rsp
+add rsp, [r15*8-8]
+add [r15*8-8], rsp
+add rsp, [0x1000]
+add [0x1000], rsp
+add rsp, [-8]
+add [-8], rsp
+add rsp, [rax+16]
+add [rax+16], rsp
+add rsp, [rax+rbx*4+16]
+add [rax+rbx*4+16], rsp
+add rsp, [r8*8+0x100]
+add [r8*8+0x100], rsp
+add rsp, [rbx+rax*2]
+add [rbx+rax*2], rsp
+add rsp, [rbx+rcx]
+add [rbx+rcx], rsp
+add rsp, [rip+data]
+add [rip+data], rsp
+add rsp, [rip+data+4]
+add [rip+data+4], rsp
+add rsp, [rip+data-4]
+add [rip+data-4], rsp
+add rsp, [rip+16]
+add [rip+16], rsp
+add rsp, [rip-0x100]
+add [rip-0x100], rsp
+add rbp, [rdi]
+add [rdi], rbp
+add rbp, [r13]
+add [r13], rbp
+add rbp, [rbp]
+add [rbp], rbp
+add rbp, [r12]
+add [r12], rbp
+add rbp, [rsp+8]
+add [rsp+8], rbp
+add rbp, [rsp-8]
+add [rsp-8], rbp
+add rbp, [r12+r9*4-200]
+add [r12+r9*4-200], rbp
+add rbp, [rbp+rcx*8]
+add [rbp+rcx*8], rbp
+add rbp, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], rbp
+add rbp, [rax*2+16]
+add [rax*2+16], rbp
+add rbp, [r15*8-8]
+add [r15*8-8], rbp
+add rbp, [0x1000]
+add [0x1000], rbp
+add rbp, [-8]
+add [-8], rbp
+add rbp, [rax+16]
+add [rax+16], rbp
+add rbp, [rax+rbx*4+16]
+add [rax+rbx*4+16], rbp
+add rbp, [r8*8+0x100]
+add [r8*8+0x100], rbp
+add rbp, [rbx+rax*2]
+add [rbx+rax*2], rbp
+add rbp, [rbx+rcx]
+add [rbx+rcx], rbp
+add rbp, [rip+data]
+add [rip+data], rbp
+add rbp, [rip+data+4]
+add [rip+data+4], rbp
+add rbp, [rip+data-4]
+add [rip+data-4], rbp
+add rbp, [rip+16]
+add [rip+16], rbp
+add rbp, [rip-0x100]
+add [rip-0x100], rbp
+add r8, [rdi]
+add [rdi], r8
+add r8, [r13]
+add [r13], r8
+add r8, [rbp]
+add [rbp], r8
+add r8, [r12]
+add [r12], r8
+add r8, [rsp+8]
+add [rsp+8], r8
+add r8, [rsp-8]
+add [rsp-8], r8
+add r8, [r12+r9*4-200]
+add [r12+r9*4-200], r8
+add r8, [rbp+rcx*8]
+add [rbp+rcx*8], r8
+add r8, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], r8
+add r8, [rax*2+16]
+add [rax*2+16], r8
+add r8, [r15*8-8]
+add [r15*8-8], r8
+add r8, [0x1000]
+add [0x1000], r8
+add r8, [-8]
+add [-8], r8
+add r8, [rax+16]
+add [rax+16], r8
+add r8, [rax+rbx*4+16]
+add [rax+rbx*4+16], r8
+add r8, [r8*8+0x100]
+add [r8*8+0x100], r8
+add r8, [rbx+rax*2]
+add [rbx+rax*2], r8
+add r8, [rbx+rcx]
+add [rbx+rcx], r8
+add r8, [rip+data]
+add [rip+data], r8
+add r8, [rip+data+4]
+add [rip+data+4], r8
+add r8, [rip+data-4]
+add [rip+data-4], r8
+add r8, [rip+16]
+add [rip+16], r8
+add r8, [rip-0x100]
+add [rip-0x100], r8
+add r12, [rdi]
+add [rdi], r12
+add r12, [r13]
+add [r13], r12
+add r12, [rbp]
+add [rbp], r12
+add r12, [r12]
+add [r12], r12
+add r12, [rsp+8]
+add [rsp+8], r12
+add r12, [rsp-8]
+add [rsp-8], r12
+add r12, [r12+r9*4-200]
+add [r12+r9*4-200], r12
+add r12, [rbp+rcx*8]
+add [rbp+rcx*8], r12
+add r12, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], r12
+add r12, [rax*2+16]
+add [rax*2+16], r12
+add r12, [r15*8-8]
+add [r15*8-8], r12
+add r12, [0x1000]
+add [0x1000], r12
+add r12, [-8]
+add [-8], r12
+add r12, [rax+16]
+add [rax+16], r12
+add r12, [rax+rbx*4+16]
+add [rax+rbx*4+16], r12
+add r12, [r8*8+0x100]
+add [r8*8+0x100], r12
+add r12, [rbx+rax*2]
+add [rbx+rax*2], r12
+add r12, [rbx+rcx]
+add [rbx+rcx], r12
+add r12, [rip+data]
+add [rip+data], r12
+add r12, [rip+data+4]
+add [rip+data+4], r12
+add r12, [rip+data-4]
+add [rip+data-4], r12
+add r12, [rip+16]
+add [rip+16], r12
+add r12, [rip-0x100]
+add [rip-0x100], r12
+add r13, [rdi]
+add [rdi], r13
+add r13, [r13]
+add [r13], r13
+add r13, [rbp]
+add [rbp], r13
+add r13, [r12]
+add [r12], r13
+add r13, [rsp+8]
+add [rsp+8], r13
+add r13, [rsp-8]
+add [rsp-8], r13
+add r13, [r12+r9*4-200]
+add [r12+r9*4-200], r13
+add r13, [rbp+rcx*8]
+add [rbp+rcx*8], r13
+add r13, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], r13
+add r13, [rax*2+16]
+add [rax*2+16], r13
+add r13, [r15*8-8]
+add [r15*8-8], r13
+add r13, [0x1000]
+add [0x1000], r13
+add r13, [-8]
+add [-8], r13
+add r13, [rax+16]
+add [rax+16], r13
+add r13, [rax+rbx*4+16]
+add [rax+rbx*4+16], r13
+add r13, [r8*8+0x100]
+add [r8*8+0x100], r13
+add r13, [rbx+rax*2]
+add [rbx+rax*2], r13
+add r13, [rbx+rcx]
+add [rbx+rcx], r13
+add r13, [rip+data]
+add [rip+data], r13
+add r13, [rip+data+4]
+add [rip+data+4], r13
+add r13, [rip+data-4]
+add [rip+data-4], r13
+add r13, [rip+16]
+add [rip+16], r13
+add r13, [rip-0x100]
+add [rip-0x100], r13
+add r15, [rdi]
+add [rdi], r15
+add r15, [r13]
+add [r13], r15
+add r15, [rbp]
+add [rbp], r15
+add r15, [r12]
+add [r12], r15
+add r15, [rsp+8]
+add [rsp+8], r15
+add r15, [rsp-8]
+add [rsp-8], r15
+add r15, [r12+r9*4-200]
+add [r12+r9*4-200], r15
+add r15, [rbp+rcx*8]
+add [rbp+rcx*8], r15
+add r15, [r13+r14*2+0x1000]
+add [r13+r14*2+0x1000], r15
+add r15, [rax*2+16]
+add [rax*2+16], r15
+add r15, [r15*8-8]
+add [r15*8-8], r15
+add r15, [0x1000]
+add [0x1000], r15
+add r15, [-8]
+add [-8], r15
+add r15, [rax+16]
+add [rax+16], r15
+add r15, [rax+rbx*4+16]
+add [rax+rbx*4+16], r15
+add r15, [r8*8+0x100]
+add [r8*8+0x100], r15
+add r15, [rbx+rax*2]
+add [rbx+rax*2], r15
+add r15, [rbx+rcx]
+add [rbx+rcx], r15
+add r15, [rip+data]
+add [rip+data], r15
+add r15, [rip+data+4]
+add [rip+data+4], r15
+add r15, [rip+data-4]
+add [rip+data-4], r15
+add r15, [rip+16]
+add [rip+16], r15
+add r15, [rip-0x100]
+add [rip-0x100], r15
+add qword ptr [rdi], 0x12345
+add qword ptr [r13], 0x12345
+add qword ptr [rbp], 0x12345
+add qword ptr [r12], 0x12345
+add qword ptr [rsp+8], 0x12345
+add qword ptr [rsp-8], 0x12345
+add qword ptr [r12+r9*4-200], 0x12345
+add qword ptr [rbp+rcx*8], 0x12345
+add qword ptr [r13+r14*2+0x1000], 0x12345
+add qword ptr [rax*2+16], 0x12345
+add qword ptr [r15*8-8], 0x12345
+add qword ptr [0x1000], 0x12345
+add qword ptr [-8], 0x12345
+add qword ptr [rax+16], 0x12345
+add qword ptr [rax+rbx*4+16], 0x12345
+add qword ptr [r8*8+0x100], 0x12345
+add qword ptr [rbx+rax*2], 0x12345
+add qword ptr [rbx+rcx], 0x12345
+add qword ptr [rip+data], 0x12345
+add qword ptr [rip+data+4], 0x12345
+add qword ptr [rip+data-4], 0x12345
+add qword ptr [rip+16], 0x12345
+add qword ptr [rip-0x100], 0x12345
+sub rax, [rdi]
+sub [rdi], rax
+sub rax, [r13]
+sub [r13], rax
+sub rax, [rbp]
+sub [rbp], rax
+sub rax, [r12]
+sub [r12], rax
+sub rax, [rsp+8]
+sub [rsp+8], rax
+sub rax, [rsp-8]
+sub [rsp-8], rax
+sub rax, [r12+r9*4-200]
+sub [r12+r9*4-200], rax
+sub rax, [rbp+rcx*8]
+sub [rbp+rcx*8], rax
+sub rax, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], rax
+sub rax, [rax*2+16]
+sub [rax*2+16], rax
+sub rax, [r15*8-8]
+sub [r15*8-8], rax
+sub rax, [0x1000]
+sub [0x1000], rax
+sub rax, [-8]
+sub [-8], rax
+sub rax, [rax+16]
+sub [rax+16], rax
+sub rax, [rax+rbx*4+16]
+sub [rax+rbx*4+16], rax
+sub rax, [r8*8+0x100]
+sub [r8*8+0x100], rax
+sub rax, [rbx+rax*2]
+sub [rbx+rax*2], rax
+sub rax, [rbx+rcx]
+sub [rbx+rcx], rax
+sub rax, [rip+data]
+sub [rip+data], rax
+sub rax, [rip+data+4]
+sub [rip+data+4], rax
+sub rax, [rip+data-4]
+sub [rip+data-4], rax
+sub rax, [rip+16]
+sub [rip+16], rax
+sub rax, [rip-0x100]
+sub [rip-0x100], rax
+sub rcx, [rdi]
+sub [rdi], rcx
+sub rcx, [r13]
+sub [r13], rcx
+sub rcx, [rbp]
+sub [rbp], rcx
+sub rcx, [r12]
+sub [r12], rcx
+sub rcx, [rsp+8]
+sub [rsp+8], rcx
+sub rcx, [rsp-8]
+sub [rsp-8], rcx
+sub rcx, [r12+r9*4-200]
+sub [r12+r9*4-200], rcx
+sub rcx, [rbp+rcx*8]
+sub [rbp+rcx*8], rcx
+sub rcx, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], rcx
+sub rcx, [rax*2+16]
+sub [rax*2+16], rcx
+sub rcx, [r15*8-8]
+sub [r15*8-8], rcx
+sub rcx, [0x1000]
+sub [0x1000], rcx
+sub rcx, [-8]
+sub [-8], rcx
+sub rcx, [rax+16]
+sub [rax+16], rcx
+sub rcx, [rax+rbx*4+16]
+sub [rax+rbx*4+16], rcx
+sub rcx, [r8*8+0x100]
+sub [r8*8+0x100], rcx
+sub rcx, [rbx+rax*2]
+sub [rbx+rax*2], rcx
+sub rcx, [rbx+rcx]
+sub [rbx+rcx], rcx
+sub rcx, [rip+data]
+sub [rip+data], rcx
+sub rcx, [rip+data+4]
+sub [rip+data+4], rcx
+sub rcx, [rip+data-4]
+sub [rip+data-4], rcx
+sub rcx, [rip+16]
+sub [rip+16], rcx
+sub rcx, [rip-0x100]
+sub [rip-0x100], rcx
+sub rsp, [rdi]
+sub [rdi], rsp
+sub rsp, [r13]
+sub [r13], rsp
+sub rsp, [rbp]
+sub [rbp], rsp
+sub rsp, [r12]
+sub [r12], rsp
+sub rsp, [rsp+8]
+sub [rsp+8], rsp
+sub rsp, [rsp-8]
+sub [rsp-8], rsp
+sub rsp, [r12+r9*4-200]
+sub [r12+r9*4-200], rsp
+sub rsp, [rbp+rcx*8]
+sub [rbp+rcx*8], rsp
+sub rsp, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], rsp
+sub rsp, [rax*2+16]
+sub [rax*2+16], rsp
+sub rsp, [r15*8-8]
+sub [r15*8-8], rsp
+sub rsp, [0x1000]
+sub [0x1000], rsp
+sub rsp, [-8]
+sub [-8], rsp
+sub rsp, [rax+16]
+sub [rax+16], rsp
+sub rsp, [rax+rbx*4+16]
+sub [rax+rbx*4+16], rsp
+sub rsp, [r8*8+0x100]
+sub [r8*8+0x100], rsp
+sub rsp, [rbx+rax*2]
+sub [rbx+rax*2], rsp
+sub rsp, [rbx+rcx]
+sub [rbx+rcx], rsp
+sub rsp, [rip+data]
+sub [rip+data], rsp
+sub rsp, [rip+data+4]
+sub [rip+data+4], rsp
+sub rsp, [rip+data-4]
+sub [rip+data-4], rsp
+sub rsp, [rip+16]
+sub [rip+16], rsp
+sub rsp, [rip-0x100]
+sub [rip-0x100], rsp
+sub rbp, [rdi]
+sub [rdi], rbp
+sub rbp, [r13]
+sub [r13], rbp
+sub rbp, [rbp]
+sub [rbp], rbp
+sub rbp, [r12]
+sub [r12], rbp
+sub rbp, [rsp+8]
+sub [rsp+8], rbp
+sub rbp, [rsp-8]
+sub [rsp-8], rbp
+sub rbp, [r12+r9*4-200]
+sub [r12+r9*4-200], rbp
+sub rbp, [rbp+rcx*8]
+sub [rbp+rcx*8], rbp
+sub rbp, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], rbp
+sub rbp, [rax*2+16]
+sub [rax*2+16], rbp
+sub rbp, [r15*8-8]
+sub [r15*8-8], rbp
+sub rbp, [0x1000]
+sub [0x1000], rbp
+sub rbp, [-8]
+sub [-8], rbp
+sub rbp, [rax+16]
+sub [rax+16], rbp
+sub rbp, [rax+rbx*4+16]
+sub [rax+rbx*4+16], rbp
+sub rbp, [r8*8+0x100]
+sub [r8*8+0x100], rbp
+sub rbp, [rbx+rax*2]
+sub [rbx+rax*2], rbp
+sub rbp, [rbx+rcx]
+sub [rbx+rcx], rbp
+sub rbp, [rip+data]
+sub [rip+data], rbp
+sub rbp, [rip+data+4]
+sub [rip+data+4], rbp
+sub rbp, [rip+data-4]
+sub [rip+data-4], rbp
+sub rbp, [rip+16]
+sub [rip+16], rbp
+sub rbp, [rip-0x100]
+sub [rip-0x100], rbp
+sub r8, [rdi]
+sub [rdi], r8
+sub r8, [r13]
+sub [r13], r8
+sub r8, [rbp]
+sub [rbp], r8
+sub r8, [r12]
+sub [r12], r8
+sub r8, [rsp+8]
+sub [rsp+8], r8
+sub r8, [rsp-8]
+sub [rsp-8], r8
+sub r8, [r12+r9*4-200]
+sub [r12+r9*4-200], r8
+sub r8, [rbp+rcx*8]
+sub [rbp+rcx*8], r8
+sub r8, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], r8
+sub r8, [rax*2+16]
+sub [rax*2+16], r8
+sub r8, [r15*8-8]
+sub [r15*8-8], r8
+sub r8, [0x1000]
+sub [0x1000], r8
+sub r8, [-8]
+sub [-8], r8
+sub r8, [rax+16]
+sub [rax+16], r8
+sub r8, [rax+rbx*4+16]
+sub [rax+rbx*4+16], r8
+sub r8, [r8*8+0x100]
+sub [r8*8+0x100], r8
+sub r8, [rbx+rax*2]
+sub [rbx+rax*2], r8
+sub r8, [rbx+rcx]
+sub [rbx+rcx], r8
+sub r8, [rip+data]
+sub [rip+data], r8
+sub r8, [rip+data+4]
+sub [rip+data+4], r8
+sub r8, [rip+data-4]
+sub [rip+data-4], r8
+sub r8, [rip+16]
+sub [rip+16], r8
+sub r8, [rip-0x100]
+sub [rip-0x100], r8
+sub r12, [rdi]
+sub [rdi], r12
+sub r12, [r13]
+sub [r13], r12
+sub r12, [rbp]
+sub [rbp], r12
+sub r12, [r12]
+sub [r12], r12
+sub r12, [rsp+8]
+sub [rsp+8], r12
+sub r12, [rsp-8]
+sub [rsp-8], r12
+sub r12, [r12+r9*4-200]
+sub [r12+r9*4-200], r12
+sub r12, [rbp+rcx*8]
+sub [rbp+rcx*8], r12
+sub r12, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], r12
+sub r12, [rax*2+16]
+sub [rax*2+16], r12
+sub r12, [r15*8-8]
+sub [r15*8-8], r12
+sub r12, [0x1000]
+sub [0x1000], r12
+sub r12, [-8]
+sub [-8], r12
+sub r12, [rax+16]
+sub [rax+16], r12
+sub r12, [rax+rbx*4+16]
+sub [rax+rbx*4+16], r12
+sub r12, [r8*8+0x100]
+sub [r8*8+0x100], r12
+sub r12, [rbx+rax*2]
+sub [rbx+rax*2], r12
+sub r12, [rbx+rcx]
+sub [rbx+rcx], r12
+sub r12, [rip+data]
+sub [rip+data], r12
+sub r12, [rip+data+4]
+sub [rip+data+4], r12
+sub r12, [rip+data-4]
+sub [rip+data-4], r12
+sub r12, [rip+16]
+sub [rip+16], r12
+sub r12, [rip-0x100]
+sub [rip-0x100], r12
+sub r13, [rdi]
+sub [rdi], r13
+sub r13, [r13]
+sub [r13], r13
+sub r13, [rbp]
+sub [rbp], r13
+sub r13, [r12]
+sub [r12], r13
+sub r13, [rsp+8]
+sub [rsp+8], r13
+sub r13, [rsp-8]
+sub [rsp-8], r13
+sub r13, [r12+r9*4-200]
+sub [r12+r9*4-200], r13
+sub r13, [rbp+rcx*8]
+sub [rbp+rcx*8], r13
+sub r13, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], r13
+sub r13, [rax*2+16]
+sub [rax*2+16], r13
+sub r13, [r15*8-8]
+sub [r15*8-8], r13
+sub r13, [0x1000]
+sub [0x1000], r13
+sub r13, [-8]
+sub [-8], r13
+sub r13, [rax+16]
+sub [rax+16], r13
+sub r13, [rax+rbx*4+16]
+sub [rax+rbx*4+16], r13
+sub r13, [r8*8+0x100]
+sub [r8*8+0x100], r13
+sub r13, [rbx+rax*2]
+sub [rbx+rax*2], r13
+sub r13, [rbx+rcx]
+sub [rbx+rcx], r13
+sub r13, [rip+data]
+sub [rip+data], r13
+sub r13, [rip+data+4]
+sub [rip+data+4], r13
+sub r13, [rip+data-4]
+sub [rip+data-4], r13
+sub r13, [rip+16]
+sub [rip+16], r13
+sub r13, [rip-0x100]
+sub [rip-0x100], r13
+sub r15, [rdi]
+sub [rdi], r15
+sub r15, [r13]
+sub [r13], r15
+sub r15, [rbp]
+sub [rbp], r15
+sub r15, [r12]
+sub [r12], r15
+sub r15, [rsp+8]
+sub [rsp+8], r15
+sub r15, [rsp-8]
+sub [rsp-8], r15
+sub r15, [r12+r9*4-200]
+sub [r12+r9*4-200], r15
+sub r15, [rbp+rcx*8]
+sub [rbp+rcx*8], r15
+sub r15, [r13+r14*2+0x1000]
+sub [r13+r14*2+0x1000], r15
+sub r15, [rax*2+16]
+sub [rax*2+16], r15
+sub r15, [r15*8-8]
+sub [r15*8-8], r15
+sub r15, [0x1000]
+sub [0x1000], r15
+sub r15, [-8]
+sub [-8], r15
+sub r15, [rax+16]
+sub [rax+16], r15
+sub r15, [rax+rbx*4+16]
+sub [rax+rbx*4+16], r15
+sub r15, [r8*8+0x100]
+sub [r8*8+0x100], r15
+sub r15, [rbx+rax*2]
+sub [rbx+rax*2], r15
+sub r15, [rbx+rcx]
+sub [rbx+rcx], r15
+sub r15, [rip+data]
+sub [rip+data], r15
+sub r15, [rip+data+4]
+sub [rip+data+4], r15
+sub r15, [rip+data-4]
+sub [rip+data-4], r15
+sub r15, [rip+16]
+sub [rip+16], r15
+sub r15, [rip-0x100]
+sub [rip-0x100], r15
+sub qword ptr [rdi], 0x12345
+sub qword ptr [r13], 0x12345
+sub qword ptr [rbp], 0x12345
+sub qword ptr [r12], 0x12345
+sub qword ptr [rsp+8], 0x12345
+sub qword ptr [rsp-8], 0x12345
+sub qword ptr [r12+r9*4-200], 0x12345
+sub qword ptr [rbp+rcx*8], 0x12345
+sub qword ptr [r13+r14*2+0x1000], 0x12345
+sub qword ptr [rax*2+16], 0x12345
+sub qword ptr [r15*8-8], 0x12345
+sub qword ptr [0x1000], 0x12345
+sub qword ptr [-8], 0x12345
+sub qword ptr [rax+16], 0x12345
+sub qword ptr [rax+rbx*4+16], 0x12345
+sub qword ptr [r8*8+0x100], 0x12345
+sub qword ptr [rbx+rax*2], 0x12345
+sub qword ptr [rbx+rcx], 0x12345
+sub qword ptr [rip+data], 0x12345
+sub qword ptr [rip+data+4], 0x12345
+sub qword ptr [rip+data-4], 0x12345
+sub qword ptr [rip+16], 0x12345
+sub qword ptr [rip-0x100], 0x12345
+cmp rax, [rdi]
+cmp [rdi], rax
+cmp rax, [r13]
+cmp [r13], rax
+cmp rax, [rbp]
+cmp [rbp], rax
+cmp rax, [r12]
+cmp [r12], rax
+cmp rax, [rsp+8]
+cmp [rsp+8], rax
+cmp rax, [rsp-8]
+cmp [rsp-8], rax
+cmp rax, [r12+r9*4-200]
+cmp [r12+r9*4-200], rax
+cmp rax, [rbp+rcx*8]
+cmp [rbp+rcx*8], rax
+cmp rax, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], rax
+cmp rax, [rax*2+16]
+cmp [rax*2+16], rax
+cmp rax, [r15*8-8]
+cmp [r15*8-8], rax
+cmp rax, [0x1000]
+cmp [0x1000], rax
+cmp rax, [-8]
+cmp [-8], rax
+cmp rax, [rax+16]
+cmp [rax+16], rax
+cmp rax, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], rax
+cmp rax, [r8*8+0x100]
+cmp [r8*8+0x100], rax
+cmp rax, [rbx+rax*2]
+cmp [rbx+rax*2], rax
+cmp rax, [rbx+rcx]
+cmp [rbx+rcx], rax
+cmp rax, [rip+data]
+cmp [rip+data], rax
+cmp rax, [rip+data+4]
+cmp [rip+data+4], rax
+cmp rax, [rip+data-4]
+cmp [rip+data-4], rax
+cmp rax, [rip+16]
+cmp [rip+16], rax
+cmp rax, [rip-0x100]
+cmp [rip-0x100], rax
+cmp rcx, [rdi]
+cmp [rdi], rcx
+cmp rcx, [r13]
+cmp [r13], rcx
+cmp rcx, [rbp]
+cmp [rbp], rcx
+cmp rcx, [r12]
+cmp [r12], rcx
+cmp rcx, [rsp+8]
+cmp [rsp+8], rcx
+cmp rcx, [rsp-8]
+cmp [rsp-8], rcx
+cmp rcx, [r12+r9*4-200]
+cmp [r12+r9*4-200], rcx
+cmp rcx, [rbp+rcx*8]
+cmp [rbp+rcx*8], rcx
+cmp rcx, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], rcx
+cmp rcx, [rax*2+16]
+cmp [rax*2+16], rcx
+cmp rcx, [r15*8-8]
+cmp [r15*8-8], rcx
+cmp rcx, [0x1000]
+cmp [0x1000], rcx
+cmp rcx, [-8]
+cmp [-8], rcx
+cmp rcx, [rax+16]
+cmp [rax+16], rcx
+cmp rcx, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], rcx
+cmp rcx, [r8*8+0x100]
+cmp [r8*8+0x100], rcx
+cmp rcx, [rbx+rax*2]
+cmp [rbx+rax*2], rcx
+cmp rcx, [rbx+rcx]
+cmp [rbx+rcx], rcx
+cmp rcx, [rip+data]
+cmp [rip+data], rcx
+cmp rcx, [rip+data+4]
+cmp [rip+data+4], rcx
+cmp rcx, [rip+data-4]
+cmp [rip+data-4], rcx
+cmp rcx, [rip+16]
+cmp [rip+16], rcx
+cmp rcx, [rip-0x100]
+cmp [rip-0x100], rcx
+cmp rsp, [rdi]
+cmp [rdi], rsp
+cmp rsp, [r13]
+cmp [r13], rsp
+cmp rsp, [rbp]
+cmp [rbp], rsp
+cmp rsp, [r12]
+cmp [r12], rsp
+cmp rsp, [rsp+8]
+cmp [rsp+8], rsp
+cmp rsp, [rsp-8]
+cmp [rsp-8], rsp
+cmp rsp, [r12+r9*4-200]
+cmp [r12+r9*4-200], rsp
+cmp rsp, [rbp+rcx*8]
+cmp [rbp+rcx*8], rsp
+cmp rsp, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], rsp
+cmp rsp, [rax*2+16]
+cmp [rax*2+16], rsp
+cmp rsp, [r15*8-8]
+cmp [r15*8-8], rsp
+cmp rsp, [0x1000]
+cmp [0x1000], rsp
+cmp rsp, [-8]
+cmp [-8], rsp
+cmp rsp, [rax+16]
+cmp [rax+16], rsp
+cmp rsp, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], rsp
+cmp rsp, [r8*8+0x100]
+cmp [r8*8+0x100], rsp
+cmp rsp, [rbx+rax*2]
+cmp [rbx+rax*2], rsp
+cmp rsp, [rbx+rcx]
+cmp [rbx+rcx], rsp
+cmp rsp, [rip+data]
+cmp [rip+data], rsp
+cmp rsp, [rip+data+4]
+cmp [rip+data+4], rsp
+cmp rsp, [rip+data-4]
+cmp [rip+data-4], rsp
+cmp rsp, [rip+16]
+cmp [rip+16], rsp
+cmp rsp, [rip-0x100]
+cmp [rip-0x100], rsp
+cmp rbp, [rdi]
+cmp [rdi], rbp
+cmp rbp, [r13]
+cmp [r13], rbp
+cmp rbp, [rbp]
+cmp [rbp], rbp
+cmp rbp, [r12]
+cmp [r12], rbp
+cmp rbp, [rsp+8]
+cmp [rsp+8], rbp
+cmp rbp, [rsp-8]
+cmp [rsp-8], rbp
+cmp rbp, [r12+r9*4-200]
+cmp [r12+r9*4-200], rbp
+cmp rbp, [rbp+rcx*8]
+cmp [rbp+rcx*8], rbp
+cmp rbp, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], rbp
+cmp rbp, [rax*2+16]
+cmp [rax*2+16], rbp
+cmp rbp, [r15*8-8]
+cmp [r15*8-8], rbp
+cmp rbp, [0x1000]
+cmp [0x1000], rbp
+cmp rbp, [-8]
+cmp [-8], rbp
+cmp rbp, [rax+16]
+cmp [rax+16], rbp
+cmp rbp, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], rbp
+cmp rbp, [r8*8+0x100]
+cmp [r8*8+0x100], rbp
+cmp rbp, [rbx+rax*2]
+cmp [rbx+rax*2], rbp
+cmp rbp, [rbx+rcx]
+cmp [rbx+rcx], rbp
+cmp rbp, [rip+data]
+cmp [rip+data], rbp
+cmp rbp, [rip+data+4]
+cmp [rip+data+4], rbp
+cmp rbp, [rip+data-4]
+cmp [rip+data-4], rbp
+cmp rbp, [rip+16]
+cmp [rip+16], rbp
+cmp rbp, [rip-0x100]
+cmp [rip-0x100], rbp
+cmp r8, [rdi]
+cmp [rdi], r8
+cmp r8, [r13]
+cmp [r13], r8
+cmp r8, [rbp]
+cmp [rbp], r8
+cmp r8, [r12]
+cmp [r12], r8
+cmp r8, [rsp+8]
+cmp [rsp+8], r8
+cmp r8, [rsp-8]
+cmp [rsp-8], r8
+cmp r8, [r12+r9*4-200]
+cmp [r12+r9*4-200], r8
+cmp r8, [rbp+rcx*8]
+cmp [rbp+rcx*8], r8
+cmp r8, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], r8
+cmp r8, [rax*2+16]
+cmp [rax*2+16], r8
+cmp r8, [r15*8-8]
+cmp [r15*8-8], r8
+cmp r8, [0x1000]
+cmp [0x1000], r8
+cmp r8, [-8]
+cmp [-8], r8
+cmp r8, [rax+16]
+cmp [rax+16], r8
+cmp r8, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], r8
+cmp r8, [r8*8+0x100]
+cmp [r8*8+0x100], r8
+cmp r8, [rbx+rax*2]
+cmp [rbx+rax*2], r8
+cmp r8, [rbx+rcx]
+cmp [rbx+rcx], r8
+cmp r8, [rip+data]
+cmp [rip+data], r8
+cmp r8, [rip+data+4]
+cmp [rip+data+4], r8
+cmp r8, [rip+data-4]
+cmp [rip+data-4], r8
+cmp r8, [rip+16]
+cmp [rip+16], r8
+cmp r8, [rip-0x100]
+cmp [rip-0x100], r8
+cmp r12, [rdi]
+cmp [rdi], r12
+cmp r12, [r13]
+cmp [r13], r12
+cmp r12, [rbp]
+cmp [rbp], r12
+cmp r12, [r12]
+cmp [r12], r12
+cmp r12, [rsp+8]
+cmp [rsp+8], r12
+cmp r12, [rsp-8]
+cmp [rsp-8], r12
+cmp r12, [r12+r9*4-200]
+cmp [r12+r9*4-200], r12
+cmp r12, [rbp+rcx*8]
+cmp [rbp+rcx*8], r12
+cmp r12, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], r12
+cmp r12, [rax*2+16]
+cmp [rax*2+16], r12
+cmp r12, [r15*8-8]
+cmp [r15*8-8], r12
+cmp r12, [0x1000]
+cmp [0x1000], r12
+cmp r12, [-8]
+cmp [-8], r12
+cmp r12, [rax+16]
+cmp [rax+16], r12
+cmp r12, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], r12
+cmp r12, [r8*8+0x100]
+cmp [r8*8+0x100], r12
+cmp r12, [rbx+rax*2]
+cmp [rbx+rax*2], r12
+cmp r12, [rbx+rcx]
+cmp [rbx+rcx], r12
+cmp r12, [rip+data]
+cmp [rip+data], r12
+cmp r12, [rip+data+4]
+cmp [rip+data+4], r12
+cmp r12, [rip+data-4]
+cmp [rip+data-4], r12
+cmp r12, [rip+16]
+cmp [rip+16], r12
+cmp r12, [rip-0x100]
+cmp [rip-0x100], r12
+cmp r13, [rdi]
+cmp [rdi], r13
+cmp r13, [r13]
+cmp [r13], r13
+cmp r13, [rbp]
+cmp [rbp], r13
+cmp r13, [r12]
+cmp [r12], r13
+cmp r13, [rsp+8]
+cmp [rsp+8], r13
+cmp r13, [rsp-8]
+cmp [rsp-8], r13
+cmp r13, [r12+r9*4-200]
+cmp [r12+r9*4-200], r13
+cmp r13, [rbp+rcx*8]
+cmp [rbp+rcx*8], r13
+cmp r13, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], r13
+cmp r13, [rax*2+16]
+cmp [rax*2+16], r13
+cmp r13, [r15*8-8]
+cmp [r15*8-8], r13
+cmp r13, [0x1000]
+cmp [0x1000], r13
+cmp r13, [-8]
+cmp [-8], r13
+cmp r13, [rax+16]
+cmp [rax+16], r13
+cmp r13, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], r13
+cmp r13, [r8*8+0x100]
+cmp [r8*8+0x100], r13
+cmp r13, [rbx+rax*2]
+cmp [rbx+rax*2], r13
+cmp r13, [rbx+rcx]
+cmp [rbx+rcx], r13
+cmp r13, [rip+data]
+cmp [rip+data], r13
+cmp r13, [rip+data+4]
+cmp [rip+data+4], r13
+cmp r13, [rip+data-4]
+cmp [rip+data-4], r13
+cmp r13, [rip+16]
+cmp [rip+16], r13
+cmp r13, [rip-0x100]
+cmp [rip-0x100], r13
+cmp r15, [rdi]
+cmp [rdi], r15
+cmp r15, [r13]
+cmp [r13], r15
+cmp r15, [rbp]
+cmp [rbp], r15
+cmp r15, [r12]
+cmp [r12], r15
+cmp r15, [rsp+8]
+cmp [rsp+8], r15
+cmp r15, [rsp-8]
+cmp [rsp-8], r15
+cmp r15, [r12+r9*4-200]
+cmp [r12+r9*4-200], r15
+cmp r15, [rbp+rcx*8]
+cmp [rbp+rcx*8], r15
+cmp r15, [r13+r14*2+0x1000]
+cmp [r13+r14*2+0x1000], r15
+cmp r15, [rax*2+16]
+cmp [rax*2+16], r15
+cmp r15, [r15*8-8]
+cmp [r15*8-8], r15
+cmp r15, [0x1000]
+cmp [0x1000], r15
+cmp r15, [-8]
+cmp [-8], r15
+cmp r15, [rax+16]
+cmp [rax+16], r15
+cmp r15, [rax+rbx*4+16]
+cmp [rax+rbx*4+16], r15
+cmp r15, [r8*8+0x100]
+cmp [r8*8+0x100], r15
+cmp r15, [rbx+rax*2]
+cmp [rbx+rax*2], r15
+cmp r15, [rbx+rcx]
+cmp [rbx+rcx], r15
+cmp r15, [rip+data]
+cmp [rip+data], r15
+cmp r15, [rip+data+4]
+cmp [rip+data+4], r15
+cmp r15, [rip+data-4]
+cmp [rip+data-4], r15
+cmp r15, [rip+16]
+cmp [rip+16], r15
+cmp r15, [rip-0x100]
+cmp [rip-0x100], r15
+cmp qword ptr [rdi], 0x12345
+cmp qword ptr [r13], 0x12345
+cmp qword ptr [rbp], 0x12345
+cmp qword ptr [r12], 0x12345
+cmp qword ptr [rsp+8], 0x12345
+cmp qword ptr [rsp-8], 0x12345
+cmp qword ptr [r12+r9*4-200], 0x12345
+cmp qword ptr [rbp+rcx*8], 0x12345
+cmp qword ptr [r13+r14*2+0x1000], 0x12345
+cmp qword ptr [rax*2+16], 0x12345
+cmp qword ptr [r15*8-8], 0x12345
+cmp qword ptr [0x1000], 0x12345
+cmp qword ptr [-8], 0x12345
+cmp qword ptr [rax+16], 0x12345
+cmp qword ptr [rax+rbx*4+16], 0x12345
+cmp qword ptr [r8*8+0x100], 0x12345
+cmp qword ptr [rbx+rax*2], 0x12345
+cmp qword ptr [rbx+rcx], 0x12345
+cmp qword ptr [rip+data], 0x12345
+cmp qword ptr [rip+data+4], 0x12345
+cmp qword ptr [rip+data-4], 0x12345
+cmp qword ptr [rip+16], 0x12345
+cmp qword ptr [rip-0x100], 0x12345
+ret
+data:
@@ -0,0 +1,2662 @@
+# Reference for corpus.rae (same lines, GNU as syntax). Regenerate corpus.bin with:
+#   as corpus.s -o corpus.o && ld -Ttext=0 --oformat binary -o corpus.bin corpus.o
+.intel_syntax noprefix
+movdqu xmm0, xmm0
+movdqu xmm0, xmm7
+movdqu xmm0, xmm8
+movdqu xmm0, xmm15
+movdqu xmm0, [rdi]
+movdqu [rdi], xmm0
+movdqu xmm0, [r13]
+movdqu [r13], xmm0
+movdqu xmm0, [rsp+8]
+movdqu [rsp+8], xmm0
+movdqu xmm0, [r12+r9*4-200]
+movdqu [r12+r9*4-200], xmm0
+movdqu xmm0, [rbp+rcx*8]
+movdqu [rbp+rcx*8], xmm0
+movdqu xmm0, [rax*2+16]
+movdqu [rax*2+16], xmm0
+movdqu xmm0, [rip+data+4]
+movdqu [rip+data+4], xmm0
+movdqu xmm0, [rip+data]
+movdqu [rip+data], xmm0
+movdqu xmm0, [rip+64]
+movdqu [rip+64], xmm0
+movdqu xmm0, [rbx-8]
+movdqu [rbx-8], xmm0
+movdqu xmm7, xmm0
+movdqu xmm7, xmm7
+movdqu xmm7, xmm8
+movdqu xmm7, xmm15
+movdqu xmm7, [rdi]
+movdqu [rdi], xmm7
+movdqu xmm7, [r13]
+movdqu [r13], xmm7
+movdqu xmm7, [rsp+8]
+movdqu [rsp+8], xmm7
+movdqu xmm7, [r12+r9*4-200]
+movdqu [r12+r9*4-200], xmm7
+movdqu xmm7, [rbp+rcx*8]
+movdqu [rbp+rcx*8], xmm7
+movdqu xmm7, [rax*2+16]
+movdqu [rax*2+16], xmm7
+movdqu xmm7, [rip+data+4]
+movdqu [rip+data+4], xmm7
+movdqu xmm7, [rip+data]
+movdqu [rip+data], xmm7
+movdqu xmm7, [rip+64]
+movdqu [rip+64], xmm7
+movdqu xmm7, [rbx-8]
+movdqu [rbx-8], xmm7
+movdqu xmm8, xmm0
+movdqu xmm8, xmm7
+movdqu xmm8, xmm8
+movdqu xmm8, xmm15
+movdqu xmm8, [rdi]
+movdqu [rdi], xmm8
+movdqu xmm8, [r13]
+movdqu [r13], xmm8
+movdqu xmm8, [rsp+8]
+movdqu [rsp+8], xmm8
+movdqu xmm8, [r12+r9*4-200]
+movdqu [r12+r9*4-200], xmm8
+movdqu xmm8, [rbp+rcx*8]
+movdqu [rbp+rcx*8], xmm8
+movdqu xmm8, [rax*2+16]
+movdqu [rax*2+16], xmm8
+movdqu xmm8, [rip+data+4]
+movdqu [rip+data+4], xmm8
+movdqu xmm8, [rip+data]
+movdqu [rip+data], xmm8
+movdqu xmm8, [rip+64]
+movdqu [rip+64], xmm8
+movdqu xmm8, [rbx-8]
+movdqu [rbx-8], xmm8
+movdqu xmm15, xmm0
+movdqu xmm15, xmm7
+movdqu xmm15, xmm8
+movdqu xmm15, xmm15
+movdqu xmm15, [rdi]
+movdqu [rdi], xmm15
+movdqu xmm15, [r13]
+movdqu [r13], xmm15
+movdqu xmm15, [rsp+8]
+movdqu [rsp+8], xmm15
+movdqu xmm15, [r12+r9*4-200]
+movdqu [r12+r9*4-200], xmm15
+movdqu xmm15, [rbp+rcx*8]
+movdqu [rbp+rcx*8], xmm15
+movdqu xmm15, [rax*2+16]
+movdqu [rax*2+16], xmm15
+movdqu xmm15, [rip+data+4]
+movdqu [rip+data+4], xmm15
+movdqu xmm15, [rip+data]
+movdqu [rip+data], xmm15
+movdqu xmm15, [rip+64]
+movdqu [rip+64], xmm15
+movdqu xmm15, [rbx-8]
+movdqu [rbx-8], xmm15
+vmovdqu xmm0, xmm0
+vmovdqu xmm0, xmm7
+vmovdqu xmm0, xmm8
+vmovdqu xmm0, xmm15
+vmovdqu xmm0, [rdi]
+vmovdqu [rdi], xmm0
+vmovdqu xmm0, [r13]
+vmovdqu [r13], xmm0
+vmovdqu xmm0, [rsp+8]
+vmovdqu [rsp+8], xmm0
+vmovdqu xmm0, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], xmm0
+vmovdqu xmm0, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], xmm0
+vmovdqu xmm0, [rax*2+16]
+vmovdqu [rax*2+16], xmm0
+vmovdqu xmm0, [rip+data+4]
+vmovdqu [rip+data+4], xmm0
+vmovdqu xmm0, [rip+data]
+vmovdqu [rip+data], xmm0
+vmovdqu xmm0, [rip+64]
+vmovdqu [rip+64], xmm0
+vmovdqu xmm0, [rbx-8]
+vmovdqu [rbx-8], xmm0
+vmovdqu xmm7, xmm0
+vmovdqu xmm7, xmm7
+vmovdqu xmm7, xmm8
+vmovdqu xmm7, xmm15
+vmovdqu xmm7, [rdi]
+vmovdqu [rdi], xmm7
+vmovdqu xmm7, [r13]
+vmovdqu [r13], xmm7
+vmovdqu xmm7, [rsp+8]
+vmovdqu [rsp+8], xmm7
+vmovdqu xmm7, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], xmm7
+vmovdqu xmm7, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], xmm7
+vmovdqu xmm7, [rax*2+16]
+vmovdqu [rax*2+16], xmm7
+vmovdqu xmm7, [rip+data+4]
+vmovdqu [rip+data+4], xmm7
+vmovdqu xmm7, [rip+data]
+vmovdqu [rip+data], xmm7
+vmovdqu xmm7, [rip+64]
+vmovdqu [rip+64], xmm7
+vmovdqu xmm7, [rbx-8]
+vmovdqu [rbx-8], xmm7
+vmovdqu xmm8, xmm0
+vmovdqu xmm8, xmm7
+vmovdqu xmm8, xmm8
+vmovdqu xmm8, xmm15
+vmovdqu xmm8, [rdi]
+vmovdqu [rdi], xmm8
+vmovdqu xmm8, [r13]
+vmovdqu [r13], xmm8
+vmovdqu xmm8, [rsp+8]
+vmovdqu [rsp+8], xmm8
+vmovdqu xmm8, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], xmm8
+vmovdqu xmm8, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], xmm8
+vmovdqu xmm8, [rax*2+16]
+vmovdqu [rax*2+16], xmm8
+vmovdqu xmm8, [rip+data+4]
+vmovdqu [rip+data+4], xmm8
+vmovdqu xmm8, [rip+data]
+vmovdqu [rip+data], xmm8
+vmovdqu xmm8, [rip+64]
+vmovdqu [rip+64], xmm8
+vmovdqu xmm8, [rbx-8]
+vmovdqu [rbx-8], xmm8
+vmovdqu xmm15, xmm0
+vmovdqu xmm15, xmm7
+vmovdqu xmm15, xmm8
+vmovdqu xmm15, xmm15
+vmovdqu xmm15, [rdi]
+vmovdqu [rdi], xmm15
+vmovdqu xmm15, [r13]
+vmovdqu [r13], xmm15
+vmovdqu xmm15, [rsp+8]
+vmovdqu [rsp+8], xmm15
+vmovdqu xmm15, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], xmm15
+vmovdqu xmm15, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], xmm15
+vmovdqu xmm15, [rax*2+16]
+vmovdqu [rax*2+16], xmm15
+vmovdqu xmm15, [rip+data+4]
+vmovdqu [rip+data+4], xmm15
+vmovdqu xmm15, [rip+data]
+vmovdqu [rip+data], xmm15
+vmovdqu xmm15, [rip+64]
+vmovdqu [rip+64], xmm15
+vmovdqu xmm15, [rbx-8]
+vmovdqu [rbx-8], xmm15
+vmovdqu ymm0, ymm0
+vmovdqu ymm0, ymm7
+vmovdqu ymm0, ymm8
+vmovdqu ymm0, ymm15
+vmovdqu ymm0, [rdi]
+vmovdqu [rdi], ymm0
+vmovdqu ymm0, [r13]
+vmovdqu [r13], ymm0
+vmovdqu ymm0, [rsp+8]
+vmovdqu [rsp+8], ymm0
+vmovdqu ymm0, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], ymm0
+vmovdqu ymm0, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], ymm0
+vmovdqu ymm0, [rax*2+16]
+vmovdqu [rax*2+16], ymm0
+vmovdqu ymm0, [rip+data+4]
+vmovdqu [rip+data+4], ymm0
+vmovdqu ymm0, [rip+data]
+vmovdqu [rip+data], ymm0
+vmovdqu ymm0, [rip+64]
+vmovdqu [rip+64], ymm0
+vmovdqu ymm0, [rbx-8]
+vmovdqu [rbx-8], ymm0
+vmovdqu ymm7, ymm0
+vmovdqu ymm7, ymm7
+vmovdqu ymm7, ymm8
+vmovdqu ymm7, ymm15
+vmovdqu ymm7, [rdi]
+vmovdqu [rdi], ymm7
+vmovdqu ymm7, [r13]
+vmovdqu [r13], ymm7
+vmovdqu ymm7, [rsp+8]
+vmovdqu [rsp+8], ymm7
+vmovdqu ymm7, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], ymm7
+vmovdqu ymm7, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], ymm7
+vmovdqu ymm7, [rax*2+16]
+vmovdqu [rax*2+16], ymm7
+vmovdqu ymm7, [rip+data+4]
+vmovdqu [rip+data+4], ymm7
+vmovdqu ymm7, [rip+data]
+vmovdqu [rip+data], ymm7
+vmovdqu ymm7, [rip+64]
+vmovdqu [rip+64], ymm7
+vmovdqu ymm7, [rbx-8]
+vmovdqu [rbx-8], ymm7
+vmovdqu ymm8, ymm0
+vmovdqu ymm8, ymm7
+vmovdqu ymm8, ymm8
+vmovdqu ymm8, ymm15
+vmovdqu ymm8, [rdi]
+vmovdqu [rdi], ymm8
+vmovdqu ymm8, [r13]
+vmovdqu [r13], ymm8
+vmovdqu ymm8, [rsp+8]
+vmovdqu [rsp+8], ymm8
+vmovdqu ymm8, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], ymm8
+vmovdqu ymm8, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], ymm8
+vmovdqu ymm8, [rax*2+16]
+vmovdqu [rax*2+16], ymm8
+vmovdqu ymm8, [rip+data+4]
+vmovdqu [rip+data+4], ymm8
+vmovdqu ymm8, [rip+data]
+vmovdqu [rip+data], ymm8
+vmovdqu ymm8, [rip+64]
+vmovdqu [rip+64], ymm8
+vmovdqu ymm8, [rbx-8]
+vmovdqu [rbx-8], ymm8
+vmovdqu ymm15, ymm0
+vmovdqu ymm15, ymm7
+vmovdqu ymm15, ymm8
+vmovdqu ymm15, ymm15
+vmovdqu ymm15, [rdi]
+vmovdqu [rdi], ymm15
+vmovdqu ymm15, [r13]
+vmovdqu [r13], ymm15
+vmovdqu ymm15, [rsp+8]
+vmovdqu [rsp+8], ymm15
+vmovdqu ymm15, [r12+r9*4-200]
+vmovdqu [r12+r9*4-200], ymm15
+vmovdqu ymm15, [rbp+rcx*8]
+vmovdqu [rbp+rcx*8], ymm15
+vmovdqu ymm15, [rax*2+16]
+vmovdqu [rax*2+16], ymm15
+vmovdqu ymm15, [rip+data+4]
+vmovdqu [rip+data+4], ymm15
+vmovdqu ymm15, [rip+data]
+vmovdqu [rip+data], ymm15
+vmovdqu ymm15, [rip+64]
+vmovdqu [rip+64], ymm15
+vmovdqu ymm15, [rbx-8]
+vmovdqu [rbx-8], ymm15
+paddd xmm0, xmm0
+paddd xmm0, xmm7
+paddd xmm0, xmm8
+paddd xmm0, xmm15
+paddd xmm0, [rdi]
+paddd xmm0, [r13]
+paddd xmm0, [rsp+8]
+paddd xmm0, [r12+r9*4-200]
+paddd xmm0, [rbp+rcx*8]
+paddd xmm0, [rax*2+16]
+paddd xmm0, [rip+data+4]
+paddd xmm0, [rip+data]
+paddd xmm0, [rip+64]
+paddd xmm0, [rbx-8]
+paddd xmm7, xmm0
+paddd xmm7, xmm7
+paddd xmm7, xmm8
+paddd xmm7, xmm15
+paddd xmm7, [rdi]
+paddd xmm7, [r13]
+paddd xmm7, [rsp+8]
+paddd xmm7, [r12+r9*4-200]
+paddd xmm7, [rbp+rcx*8]
+paddd xmm7, [rax*2+16]
+paddd xmm7, [rip+data+4]
+paddd xmm7, [rip+data]
+paddd xmm7, [rip+64]
+paddd xmm7, [rbx-8]
+paddd xmm8, xmm0
+paddd xmm8, xmm7
+paddd xmm8, xmm8
+paddd xmm8, xmm15
+paddd xmm8, [rdi]
+paddd xmm8, [r13]
+paddd xmm8, [rsp+8]
+paddd xmm8, [r12+r9*4-200]
+paddd xmm8, [rbp+rcx*8]
+paddd xmm8, [rax*2+16]
+paddd xmm8, [rip+data+4]
+paddd xmm8, [rip+data]
+paddd xmm8, [rip+64]
+paddd xmm8, [rbx-8]
+paddd xmm15, xmm0
+paddd xmm15, xmm7
+paddd xmm15, xmm8
+paddd xmm15, xmm15
+paddd xmm15, [rdi]
+paddd xmm15, [r13]
+paddd xmm15, [rsp+8]
+paddd xmm15, [r12+r9*4-200]
+paddd xmm15, [rbp+rcx*8]
+paddd xmm15, [rax*2+16]
+paddd xmm15, [rip+data+4]
+paddd xmm15, [rip+data]
+paddd xmm15, [rip+64]
+paddd xmm15, [rbx-8]
+pxor xmm0, xmm0
+pxor xmm0, xmm7
+pxor xmm0, xmm8
+pxor xmm0, xmm15
+pxor xmm0, [rdi]
+pxor xmm0, [r13]
+pxor xmm0, [rsp+8]
+pxor xmm0, [r12+r9*4-200]
+pxor xmm0, [rbp+rcx*8]
+pxor xmm0, [rax*2+16]
+pxor xmm0, [rip+data+4]
+pxor xmm0, [rip+data]
+pxor xmm0, [rip+64]
+pxor xmm0, [rbx-8]
+pxor xmm7, xmm0
+pxor xmm7, xmm7
+pxor xmm7, xmm8
+pxor xmm7, xmm15
+pxor xmm7, [rdi]
+pxor xmm7, [r13]
+pxor xmm7, [rsp+8]
+pxor xmm7, [r12+r9*4-200]
+pxor xmm7, [rbp+rcx*8]
+pxor xmm7, [rax*2+16]
+pxor xmm7, [rip+data+4]
+pxor xmm7, [rip+data]
+pxor xmm7, [rip+64]
+pxor xmm7, [rbx-8]
+pxor xmm8, xmm0
+pxor xmm8, xmm7
+pxor xmm8, xmm8
+pxor xmm8, xmm15
+pxor xmm8, [rdi]
+pxor xmm8, [r13]
+pxor xmm8, [rsp+8]
+pxor xmm8, [r12+r9*4-200]
+pxor xmm8, [rbp+rcx*8]
+pxor xmm8, [rax*2+16]
+pxor xmm8, [rip+data+4]
+pxor xmm8, [rip+data]
+pxor xmm8, [rip+64]
+pxor xmm8, [rbx-8]
+pxor xmm15, xmm0
+pxor xmm15, xmm7
+pxor xmm15, xmm8
+pxor xmm15, xmm15
+pxor xmm15, [rdi]
+pxor xmm15, [r13]
+pxor xmm15, [rsp+8]
+pxor xmm15, [r12+r9*4-200]
+pxor xmm15, [rbp+rcx*8]
+pxor xmm15, [rax*2+16]
+pxor xmm15, [rip+data+4]
+pxor xmm15, [rip+data]
+pxor xmm15, [rip+64]
+pxor xmm15, [rbx-8]
+pcmpeqb xmm0, xmm0
+pcmpeqb xmm0, xmm7
+pcmpeqb xmm0, xmm8
+pcmpeqb xmm0, xmm15
+pcmpeqb xmm0, [rdi]
+pcmpeqb xmm0, [r13]
+pcmpeqb xmm0, [rsp+8]
+pcmpeqb xmm0, [r12+r9*4-200]
+pcmpeqb xmm0, [rbp+rcx*8]
+pcmpeqb xmm0, [rax*2+16]
+pcmpeqb xmm0, [rip+data+4]
+pcmpeqb xmm0, [rip+data]
+pcmpeqb xmm0, [rip+64]
+pcmpeqb xmm0, [rbx-8]
+pcmpeqb xmm7, xmm0
+pcmpeqb xmm7, xmm7
+pcmpeqb xmm7, xmm8
+pcmpeqb xmm7, xmm15
+pcmpeqb xmm7, [rdi]
+pcmpeqb xmm7, [r13]
+pcmpeqb xmm7, [rsp+8]
+pcmpeqb xmm7, [r12+r9*4-200]
+pcmpeqb xmm7, [rbp+rcx*8]
+pcmpeqb xmm7, [rax*2+16]
+pcmpeqb xmm7, [rip+data+4]
+pcmpeqb xmm7, [rip+data]
+pcmpeqb xmm7, [rip+64]
+pcmpeqb xmm7, [rbx-8]
+pcmpeqb xmm8, xmm0
+pcmpeqb xmm8, xmm7
+pcmpeqb xmm8, xmm8
+pcmpeqb xmm8, xmm15
+pcmpeqb xmm8, [rdi]
+pcmpeqb xmm8, [r13]
+pcmpeqb xmm8, [rsp+8]
+pcmpeqb xmm8, [r12+r9*4-200]
+pcmpeqb xmm8, [rbp+rcx*8]
+pcmpeqb xmm8, [rax*2+16]
+pcmpeqb xmm8, [rip+data+4]
+pcmpeqb xmm8, [rip+data]
+pcmpeqb xmm8, [rip+64]
+pcmpeqb xmm8, [rbx-8]
+pcmpeqb xmm15, xmm0
+pcmpeqb xmm15, xmm7
+pcmpeqb xmm15, xmm8
+pcmpeqb xmm15, xmm15
+pcmpeqb xmm15, [rdi]
+pcmpeqb xmm15, [r13]
+pcmpeqb xmm15, [rsp+8]
+pcmpeqb xmm15, [r12+r9*4-200]
+pcmpeqb xmm15, [rbp+rcx*8]
+pcmpeqb xmm15, [rax*2+16]
+pcmpeqb xmm15, [rip+data+4]
+pcmpeqb xmm15, [rip+data]
+pcmpeqb xmm15, [rip+64]
+pcmpeqb xmm15, [rbx-8]
+vpaddd xmm0, xmm0, xmm0
+vpaddd xmm0, xmm0, xmm7
+vpaddd xmm0, xmm0, xmm8
+vpaddd xmm0, xmm0, xmm15
+vpaddd xmm0, xmm7, xmm0
+vpaddd xmm0, xmm7, xmm7
+vpaddd xmm0, xmm7, xmm8
+vpaddd xmm0, xmm7, xmm15
+vpaddd xmm0, xmm8, xmm0
+vpaddd xmm0, xmm8, xmm7
+vpaddd xmm0, xmm8, xmm8
+vpaddd xmm0, xmm8, xmm15
+vpaddd xmm0, xmm15, xmm0
+vpaddd xmm0, xmm15, xmm7
+vpaddd xmm0, xmm15, xmm8
+vpaddd xmm0, xmm15, xmm15
+vpaddd xmm0, xmm7, [rdi]
+vpaddd xmm0, xmm7, [r13]
+vpaddd xmm0, xmm7, [rsp+8]
+vpaddd xmm0, xmm7, [r12+r9*4-200]
+vpaddd xmm0, xmm7, [rbp+rcx*8]
+vpaddd xmm0, xmm7, [rax*2+16]
+vpaddd xmm0, xmm7, [rip+data+4]
+vpaddd xmm0, xmm7, [rip+data]
+vpaddd xmm0, xmm7, [rip+64]
+vpaddd xmm0, xmm7, [rbx-8]
+vpaddd xmm7, xmm0, xmm0
+vpaddd xmm7, xmm0, xmm7
+vpaddd xmm7, xmm0, xmm8
+vpaddd xmm7, xmm0, xmm15
+vpaddd xmm7, xmm7, xmm0
+vpaddd xmm7, xmm7, xmm7
+vpaddd xmm7, xmm7, xmm8
+vpaddd xmm7, xmm7, xmm15
+vpaddd xmm7, xmm8, xmm0
+vpaddd xmm7, xmm8, xmm7
+vpaddd xmm7, xmm8, xmm8
+vpaddd xmm7, xmm8, xmm15
+vpaddd xmm7, xmm15, xmm0
+vpaddd xmm7, xmm15, xmm7
+vpaddd xmm7, xmm15, xmm8
+vpaddd xmm7, xmm15, xmm15
+vpaddd xmm7, xmm14, [rdi]
+vpaddd xmm7, xmm14, [r13]
+vpaddd xmm7, xmm14, [rsp+8]
+vpaddd xmm7, xmm14, [r12+r9*4-200]
+vpaddd xmm7, xmm14, [rbp+rcx*8]
+vpaddd xmm7, xmm14, [rax*2+16]
+vpaddd xmm7, xmm14, [rip+data+4]
+vpaddd xmm7, xmm14, [rip+data]
+vpaddd xmm7, xmm14, [rip+64]
+vpaddd xmm7, xmm14, [rbx-8]
+vpaddd xmm8, xmm0, xmm0
+vpaddd xmm8, xmm0, xmm7
+vpaddd xmm8, xmm0, xmm8
+vpaddd xmm8, xmm0, xmm15
+vpaddd xmm8, xmm7, xmm0
+vpaddd xmm8, xmm7, xmm7
+vpaddd xmm8, xmm7, xmm8
+vpaddd xmm8, xmm7, xmm15
+vpaddd xmm8, xmm8, xmm0
+vpaddd xmm8, xmm8, xmm7
+vpaddd xmm8, xmm8, xmm8
+vpaddd xmm8, xmm8, xmm15
+vpaddd xmm8, xmm15, xmm0
+vpaddd xmm8, xmm15, xmm7
+vpaddd xmm8, xmm15, xmm8
+vpaddd xmm8, xmm15, xmm15
+vpaddd xmm8, xmm15, [rdi]
+vpaddd xmm8, xmm15, [r13]
+vpaddd xmm8, xmm15, [rsp+8]
+vpaddd xmm8, xmm15, [r12+r9*4-200]
+vpaddd xmm8, xmm15, [rbp+rcx*8]
+vpaddd xmm8, xmm15, [rax*2+16]
+vpaddd xmm8, xmm15, [rip+data+4]
+vpaddd xmm8, xmm15, [rip+data]
+vpaddd xmm8, xmm15, [rip+64]
+vpaddd xmm8, xmm15, [rbx-8]
+vpaddd xmm15, xmm0, xmm0
+vpaddd xmm15, xmm0, xmm7
+vpaddd xmm15, xmm0, xmm8
+vpaddd xmm15, xmm0, xmm15
+vpaddd xmm15, xmm7, xmm0
+vpaddd xmm15, xmm7, xmm7
+vpaddd xmm15, xmm7, xmm8
+vpaddd xmm15, xmm7, xmm15
+vpaddd xmm15, xmm8, xmm0
+vpaddd xmm15, xmm8, xmm7
+vpaddd xmm15, xmm8, xmm8
+vpaddd xmm15, xmm8, xmm15
+vpaddd xmm15, xmm15, xmm0
+vpaddd xmm15, xmm15, xmm7
+vpaddd xmm15, xmm15, xmm8
+vpaddd xmm15, xmm15, xmm15
+vpaddd xmm15, xmm6, [rdi]
+vpaddd xmm15, xmm6, [r13]
+vpaddd xmm15, xmm6, [rsp+8]
+vpaddd xmm15, xmm6, [r12+r9*4-200]
+vpaddd xmm15, xmm6, [rbp+rcx*8]
+vpaddd xmm15, xmm6, [rax*2+16]
+vpaddd xmm15, xmm6, [rip+data+4]
+vpaddd xmm15, xmm6, [rip+data]
+vpaddd xmm15, xmm6, [rip+64]
+vpaddd xmm15, xmm6, [rbx-8]
+vpaddd ymm0, ymm0, ymm0
+vpaddd ymm0, ymm0, ymm7
+vpaddd ymm0, ymm0, ymm8
+vpaddd ymm0, ymm0, ymm15
+vpaddd ymm0, ymm7, ymm0
+vpaddd ymm0, ymm7, ymm7
+vpaddd ymm0, ymm7, ymm8
+vpaddd ymm0, ymm7, ymm15
+vpaddd ymm0, ymm8, ymm0
+vpaddd ymm0, ymm8, ymm7
+vpaddd ymm0, ymm8, ymm8
+vpaddd ymm0, ymm8, ymm15
+vpaddd ymm0, ymm15, ymm0
+vpaddd ymm0, ymm15, ymm7
+vpaddd ymm0, ymm15, ymm8
+vpaddd ymm0, ymm15, ymm15
+vpaddd ymm0, ymm7, [rdi]
+vpaddd ymm0, ymm7, [r13]
+vpaddd ymm0, ymm7, [rsp+8]
+vpaddd ymm0, ymm7, [r12+r9*4-200]
+vpaddd ymm0, ymm7, [rbp+rcx*8]
+vpaddd ymm0, ymm7, [rax*2+16]
+vpaddd ymm0, ymm7, [rip+data+4]
+vpaddd ymm0, ymm7, [rip+data]
+vpaddd ymm0, ymm7, [rip+64]
+vpaddd ymm0, ymm7, [rbx-8]
+vpaddd ymm7, ymm0, ymm0
+vpaddd ymm7, ymm0, ymm7
+vpaddd ymm7, ymm0, ymm8
+vpaddd ymm7, ymm0, ymm15
+vpaddd ymm7, ymm7, ymm0
+vpaddd ymm7, ymm7, ymm7
+vpaddd ymm7, ymm7, ymm8
+vpaddd ymm7, ymm7, ymm15
+vpaddd ymm7, ymm8, ymm0
+vpaddd ymm7, ymm8, ymm7
+vpaddd ymm7, ymm8, ymm8
+vpaddd ymm7, ymm8, ymm15
+vpaddd ymm7, ymm15, ymm0
+vpaddd ymm7, ymm15, ymm7
+vpaddd ymm7, ymm15, ymm8
+vpaddd ymm7, ymm15, ymm15
+vpaddd ymm7, ymm14, [rdi]
+vpaddd ymm7, ymm14, [r13]
+vpaddd ymm7, ymm14, [rsp+8]
+vpaddd ymm7, ymm14, [r12+r9*4-200]
+vpaddd ymm7, ymm14, [rbp+rcx*8]
+vpaddd ymm7, ymm14, [rax*2+16]
+vpaddd ymm7, ymm14, [rip+data+4]
+vpaddd ymm7, ymm14, [rip+data]
+vpaddd ymm7, ymm14, [rip+64]
+vpaddd ymm7, ymm14, [rbx-8]
+vpaddd ymm8, ymm0, ymm0
+vpaddd ymm8, ymm0, ymm7
+vpaddd ymm8, ymm0, ymm8
+vpaddd ymm8, ymm0, ymm15
+vpaddd ymm8, ymm7, ymm0
+vpaddd ymm8, ymm7, ymm7
+vpaddd ymm8, ymm7, ymm8
+vpaddd ymm8, ymm7, ymm15
+vpaddd ymm8, ymm8, ymm0
+vpaddd ymm8, ymm8, ymm7
+vpaddd ymm8, ymm8, ymm8
+vpaddd ymm8, ymm8, ymm15
+vpaddd ymm8, ymm15, ymm0
+vpaddd ymm8, ymm15, ymm7
+vpaddd ymm8, ymm15, ymm8
+vpaddd ymm8, ymm15, ymm15
+vpaddd ymm8, ymm15, [rdi]
+vpaddd ymm8, ymm15, [r13]
+vpaddd ymm8, ymm15, [rsp+8]
+vpaddd ymm8, ymm15, [r12+r9*4-200]
+vpaddd ymm8, ymm15, [rbp+rcx*8]
+vpaddd ymm8, ymm15, [rax*2+16]
+vpaddd ymm8, ymm15, [rip+data+4]
+vpaddd ymm8, ymm15, [rip+data]
+vpaddd ymm8, ymm15, [rip+64]
+vpaddd ymm8, ymm15, [rbx-8]
+vpaddd ymm15, ymm0, ymm0
+vpaddd ymm15, ymm0, ymm7
+vpaddd ymm15, ymm0, ymm8
+vpaddd ymm15, ymm0, ymm15
+vpaddd ymm15, ymm7, ymm0
+vpaddd ymm15, ymm7, ymm7
+vpaddd ymm15, ymm7, ymm8
+vpaddd ymm15, ymm7, ymm15
+vpaddd ymm15, ymm8, ymm0
+vpaddd ymm15, ymm8, ymm7
+vpaddd ymm15, ymm8, ymm8
+vpaddd ymm15, ymm8, ymm15
+vpaddd ymm15, ymm15, ymm0
+vpaddd ymm15, ymm15, ymm7
+vpaddd ymm15, ymm15, ymm8
+vpaddd ymm15, ymm15, ymm15
+vpaddd ymm15, ymm6, [rdi]
+vpaddd ymm15, ymm6, [r13]
+vpaddd ymm15, ymm6, [rsp+8]
+vpaddd ymm15, ymm6, [r12+r9*4-200]
+vpaddd ymm15, ymm6, [rbp+rcx*8]
+vpaddd ymm15, ymm6, [rax*2+16]
+vpaddd ymm15, ymm6, [rip+data+4]
+vpaddd ymm15, ymm6, [rip+data]
+vpaddd ymm15, ymm6, [rip+64]
+vpaddd ymm15, ymm6, [rbx-8]
+vpxor xmm0, xmm0, xmm0
+vpxor xmm0, xmm0, xmm7
+vpxor xmm0, xmm0, xmm8
+vpxor xmm0, xmm0, xmm15
+vpxor xmm0, xmm7, xmm0
+vpxor xmm0, xmm7, xmm7
+vpxor xmm0, xmm7, xmm8
+vpxor xmm0, xmm7, xmm15
+vpxor xmm0, xmm8, xmm0
+vpxor xmm0, xmm8, xmm7
+vpxor xmm0, xmm8, xmm8
+vpxor xmm0, xmm8, xmm15
+vpxor xmm0, xmm15, xmm0
+vpxor xmm0, xmm15, xmm7
+vpxor xmm0, xmm15, xmm8
+vpxor xmm0, xmm15, xmm15
+vpxor xmm0, xmm7, [rdi]
+vpxor xmm0, xmm7, [r13]
+vpxor xmm0, xmm7, [rsp+8]
+vpxor xmm0, xmm7, [r12+r9*4-200]
+vpxor xmm0, xmm7, [rbp+rcx*8]
+vpxor xmm0, xmm7, [rax*2+16]
+vpxor xmm0, xmm7, [rip+data+4]
+vpxor xmm0, xmm7, [rip+data]
+vpxor xmm0, xmm7, [rip+64]
+vpxor xmm0, xmm7, [rbx-8]
+vpxor xmm7, xmm0, xmm0
+vpxor xmm7, xmm0, xmm7
+vpxor xmm7, xmm0, xmm8
+vpxor xmm7, xmm0, xmm15
+vpxor xmm7, xmm7, xmm0
+vpxor xmm7, xmm7, xmm7
+vpxor xmm7, xmm7, xmm8
+vpxor xmm7, xmm7, xmm15
+vpxor xmm7, xmm8, xmm0
+vpxor xmm7, xmm8, xmm7
+vpxor xmm7, xmm8, xmm8
+vpxor xmm7, xmm8, xmm15
+vpxor xmm7, xmm15, xmm0
+vpxor xmm7, xmm15, xmm7
+vpxor xmm7, xmm15, xmm8
+vpxor xmm7, xmm15, xmm15
+vpxor xmm7, xmm14, [rdi]
+vpxor xmm7, xmm14, [r13]
+vpxor xmm7, xmm14, [rsp+8]
+vpxor xmm7, xmm14, [r12+r9*4-200]
+vpxor xmm7, xmm14, [rbp+rcx*8]
+vpxor xmm7, xmm14, [rax*2+16]
+vpxor xmm7, xmm14, [rip+data+4]
+vpxor xmm7, xmm14, [rip+data]
+vpxor xmm7, xmm14, [rip+64]
+vpxor xmm7, xmm14, [rbx-8]
+vpxor xmm8, xmm0, xmm0
+vpxor xmm8, xmm0, xmm7
+vpxor xmm8, xmm0, xmm8
+vpxor xmm8, xmm0, xmm15
+vpxor xmm8, xmm7, xmm0
+vpxor xmm8, xmm7, xmm7
+vpxor xmm8, xmm7, xmm8
+vpxor xmm8, xmm7, xmm15
+vpxor xmm8, xmm8, xmm0
+vpxor xmm8, xmm8, xmm7
+vpxor xmm8, xmm8, xmm8
+vpxor xmm8, xmm8, xmm15
+vpxor xmm8, xmm15, xmm0
+vpxor xmm8, xmm15, xmm7
+vpxor xmm8, xmm15, xmm8
+vpxor xmm8, xmm15, xmm15
+vpxor xmm8, xmm15, [rdi]
+vpxor xmm8, xmm15, [r13]
+vpxor xmm8, xmm15, [rsp+8]
+vpxor xmm8, xmm15, [r12+r9*4-200]
+vpxor xmm8, xmm15, [rbp+rcx*8]
+vpxor xmm8, xmm15, [rax*2+16]
+vpxor xmm8, xmm15, [rip+data+4]
+vpxor xmm8, xmm15, [rip+data]
+vpxor xmm8, xmm15, [rip+64]
+vpxor xmm8, xmm15, [rbx-8]
+vpxor xmm15, xmm0, xmm0
+vpxor xmm15, xmm0, xmm7
+vpxor xmm15, xmm0, xmm8
+vpxor xmm15, xmm0, xmm15
+vpxor xmm15, xmm7, xmm0
+vpxor xmm15, xmm7, xmm7
+vpxor xmm15, xmm7, xmm8
+vpxor xmm15, xmm7, xmm15
+vpxor xmm15, xmm8, xmm0
+vpxor xmm15, xmm8, xmm7
+vpxor xmm15, xmm8, xmm8
+vpxor xmm15, xmm8, xmm15
+vpxor xmm15, xmm15, xmm0
+vpxor xmm15, xmm15, xmm7
+vpxor xmm15, xmm15, xmm8
+vpxor xmm15, xmm15, xmm15
+vpxor xmm15, xmm6, [rdi]
+vpxor xmm15, xmm6, [r13]
+vpxor xmm15, xmm6, [rsp+8]
+vpxor xmm15, xmm6, [r12+r9*4-200]
+vpxor xmm15, xmm6, [rbp+rcx*8]
+vpxor xmm15, xmm6, [rax*2+16]
+vpxor xmm15, xmm6, [rip+data+4]
+vpxor xmm15, xmm6, [rip+data]
+vpxor xmm15, xmm6, [rip+64]
+vpxor xmm15, xmm6, [rbx-8]
+vpxor ymm0, ymm0, ymm0
+vpxor ymm0, ymm0, ymm7
+vpxor ymm0, ymm0, ymm8
+vpxor ymm0, ymm0, ymm15
+vpxor ymm0, ymm7, ymm0
+vpxor ymm0, ymm7, ymm7
+vpxor ymm0, ymm7, ymm8
+vpxor ymm0, ymm7, ymm15
+vpxor ymm0, ymm8, ymm0
+vpxor ymm0, ymm8, ymm7
+vpxor ymm0, ymm8, ymm8
+vpxor ymm0, ymm8, ymm15
+vpxor ymm0, ymm15, ymm0
+vpxor ymm0, ymm15, ymm7
+vpxor ymm0, ymm15, ymm8
+vpxor ymm0, ymm15, ymm15
+vpxor ymm0, ymm7, [rdi]
+vpxor ymm0, ymm7, [r13]
+vpxor ymm0, ymm7, [rsp+8]
+vpxor ymm0, ymm7, [r12+r9*4-200]
+vpxor ymm0, ymm7, [rbp+rcx*8]
+vpxor ymm0, ymm7, [rax*2+16]
+vpxor ymm0, ymm7, [rip+data+4]
+vpxor ymm0, ymm7, [rip+data]
+vpxor ymm0, ymm7, [rip+64]
+vpxor ymm0, ymm7, [rbx-8]
+vpxor ymm7, ymm0, ymm0
+vpxor ymm7, ymm0, ymm7
+vpxor ymm7, ymm0, ymm8
+vpxor ymm7, ymm0, ymm15
+vpxor ymm7, ymm7, ymm0
+vpxor ymm7, ymm7, ymm7
+vpxor ymm7, ymm7, ymm8
+vpxor ymm7, ymm7, ymm15
+vpxor ymm7, ymm8, ymm0
+vpxor ymm7, ymm8, ymm7
+vpxor ymm7, ymm8, ymm8
+vpxor ymm7, ymm8, ymm15
+vpxor ymm7, ymm15, ymm0
+vpxor ymm7, ymm15, ymm7
+vpxor ymm7, ymm15, ymm8
+vpxor ymm7, ymm15, ymm15
+vpxor ymm7, ymm14, [rdi]
+vpxor ymm7, ymm14, [r13]
+vpxor ymm7, ymm14, [rsp+8]
+vpxor ymm7, ymm14, [r12+r9*4-200]
+vpxor ymm7, ymm14, [rbp+rcx*8]
+vpxor ymm7, ymm14, [rax*2+16]
+vpxor ymm7, ymm14, [rip+data+4]
+vpxor ymm7, ymm14, [rip+data]
+vpxor ymm7, ymm14, [rip+64]
+vpxor ymm7, ymm14, [rbx-8]
+vpxor ymm8, ymm0, ymm0
+vpxor ymm8, ymm0, ymm7
+vpxor ymm8, ymm0, ymm8
+vpxor ymm8, ymm0, ymm15
+vpxor ymm8, ymm7, ymm0
+vpxor ymm8, ymm7, ymm7
+vpxor ymm8, ymm7, ymm8
+vpxor ymm8, ymm7, ymm15
+vpxor ymm8, ymm8, ymm0
+vpxor ymm8, ymm8, ymm7
+vpxor ymm8, ymm8, ymm8
+vpxor ymm8, ymm8, ymm15
+vpxor ymm8, ymm15, ymm0
+vpxor ymm8, ymm15, ymm7
+vpxor ymm8, ymm15, ymm8
+vpxor ymm8, ymm15, ymm15
+vpxor ymm8, ymm15, [rdi]
+vpxor ymm8, ymm15, [r13]
+vpxor ymm8, ymm15, [rsp+8]
+vpxor ymm8, ymm15, [r12+r9*4-200]
+vpxor ymm8, ymm15, [rbp+rcx*8]
+vpxor ymm8, ymm15, [rax*2+16]
+vpxor ymm8, ymm15, [rip+data+4]
+vpxor ymm8, ymm15, [rip+data]
+vpxor ymm8, ymm15, [rip+64]
+vpxor ymm8, ymm15, [rbx-8]
+vpxor ymm15, ymm0, ymm0
+vpxor ymm15, ymm0, ymm7
+vpxor ymm15, ymm0, ymm8
+vpxor ymm15, ymm0, ymm15
+vpxor ymm15, ymm7, ymm0
+vpxor ymm15, ymm7, ymm7
+vpxor ymm15, ymm7, ymm8
+vpxor ymm15, ymm7, ymm15
+vpxor ymm15, ymm8, ymm0
+vpxor ymm15, ymm8, ymm7
+vpxor ymm15, ymm8, ymm8
+vpxor ymm15, ymm8, ymm15
+vpxor ymm15, ymm15, ymm0
+vpxor ymm15, ymm15, ymm7
+vpxor ymm15, ymm15, ymm8
+vpxor ymm15, ymm15, ymm15
+vpxor ymm15, ymm6, [rdi]
+vpxor ymm15, ymm6, [r13]
+vpxor ymm15, ymm6, [rsp+8]
+vpxor ymm15, ymm6, [r12+r9*4-200]
+vpxor ymm15, ymm6, [rbp+rcx*8]
+vpxor ymm15, ymm6, [rax*2+16]
+vpxor ymm15, ymm6, [rip+data+4]
+vpxor ymm15, ymm6, [rip+data]
+vpxor ymm15, ymm6, [rip+64]
+vpxor ymm15, ymm6, [rbx-8]
+vpcmpeqb xmm0, xmm0, xmm0
+vpcmpeqb xmm0, xmm0, xmm7
+vpcmpeqb xmm0, xmm0, xmm8
+vpcmpeqb xmm0, xmm0, xmm15
+vpcmpeqb xmm0, xmm7, xmm0
+vpcmpeqb xmm0, xmm7, xmm7
+vpcmpeqb xmm0, xmm7, xmm8
+vpcmpeqb xmm0, xmm7, xmm15
+vpcmpeqb xmm0, xmm8, xmm0
+vpcmpeqb xmm0, xmm8, xmm7
+vpcmpeqb xmm0, xmm8, xmm8
+vpcmpeqb xmm0, xmm8, xmm15
+vpcmpeqb xmm0, xmm15, xmm0
+vpcmpeqb xmm0, xmm15, xmm7
+vpcmpeqb xmm0, xmm15, xmm8
+vpcmpeqb xmm0, xmm15, xmm15
+vpcmpeqb xmm0, xmm7, [rdi]
+vpcmpeqb xmm0, xmm7, [r13]
+vpcmpeqb xmm0, xmm7, [rsp+8]
+vpcmpeqb xmm0, xmm7, [r12+r9*4-200]
+vpcmpeqb xmm0, xmm7, [rbp+rcx*8]
+vpcmpeqb xmm0, xmm7, [rax*2+16]
+vpcmpeqb xmm0, xmm7, [rip+data+4]
+vpcmpeqb xmm0, xmm7, [rip+data]
+vpcmpeqb xmm0, xmm7, [rip+64]
+vpcmpeqb xmm0, xmm7, [rbx-8]
+vpcmpeqb xmm7, xmm0, xmm0
+vpcmpeqb xmm7, xmm0, xmm7
+vpcmpeqb xmm7, xmm0, xmm8
+vpcmpeqb xmm7, xmm0, xmm15
+vpcmpeqb xmm7, xmm7, xmm0
+vpcmpeqb xmm7, xmm7, xmm7
+vpcmpeqb xmm7, xmm7, xmm8
+vpcmpeqb xmm7, xmm7, xmm15
+vpcmpeqb xmm7, xmm8, xmm0
+vpcmpeqb xmm7, xmm8, xmm7
+vpcmpeqb xmm7, xmm8, xmm8
+vpcmpeqb xmm7, xmm8, xmm15
+vpcmpeqb xmm7, xmm15, xmm0
+vpcmpeqb xmm7, xmm15, xmm7
+vpcmpeqb xmm7, xmm15, xmm8
+vpcmpeqb xmm7, xmm15, xmm15
+vpcmpeqb xmm7, xmm14, [rdi]
+vpcmpeqb xmm7, xmm14, [r13]
+vpcmpeqb xmm7, xmm14, [rsp+8]
+vpcmpeqb xmm7, xmm14, [r12+r9*4-200]
+vpcmpeqb xmm7, xmm14, [rbp+rcx*8]
+vpcmpeqb xmm7, xmm14, [rax*2+16]
+vpcmpeqb xmm7, xmm14, [rip+data+4]
+vpcmpeqb xmm7, xmm14, [rip+data]
+vpcmpeqb xmm7, xmm14, [rip+64]
+vpcmpeqb xmm7, xmm14, [rbx-8]
+vpcmpeqb xmm8, xmm0, xmm0
+vpcmpeqb xmm8, xmm0, xmm7
+vpcmpeqb xmm8, xmm0, xmm8
+vpcmpeqb xmm8, xmm0, xmm15
+vpcmpeqb xmm8, xmm7, xmm0
+vpcmpeqb xmm8, xmm7, xmm7
+vpcmpeqb xmm8, xmm7, xmm8
+vpcmpeqb xmm8, xmm7, xmm15
+vpcmpeqb xmm8, xmm8, xmm0
+vpcmpeqb xmm8, xmm8, xmm7
+vpcmpeqb xmm8, xmm8, xmm8
+vpcmpeqb xmm8, xmm8, xmm15
+vpcmpeqb xmm8, xmm15, xmm0
+vpcmpeqb xmm8, xmm15, xmm7
+vpcmpeqb xmm8, xmm15, xmm8
+vpcmpeqb xmm8, xmm15, xmm15
+vpcmpeqb xmm8, xmm15, [rdi]
+vpcmpeqb xmm8, xmm15, [r13]
+vpcmpeqb xmm8, xmm15, [rsp+8]
+vpcmpeqb xmm8, xmm15, [r12+r9*4-200]
+vpcmpeqb xmm8, xmm15, [rbp+rcx*8]
+vpcmpeqb xmm8, xmm15, [rax*2+16]
+vpcmpeqb xmm8, xmm15, [rip+data+4]
+vpcmpeqb xmm8, xmm15, [rip+data]
+vpcmpeqb xmm8, xmm15, [rip+64]
+vpcmpeqb xmm8, xmm15, [rbx-8]
+vpcmpeqb xmm15, xmm0, xmm0
+vpcmpeqb xmm15, xmm0, xmm7
+vpcmpeqb xmm15, xmm0, xmm8
+vpcmpeqb xmm15, xmm0, xmm15
+vpcmpeqb xmm15, xmm7, xmm0
+vpcmpeqb xmm15, xmm7, xmm7
+vpcmpeqb xmm15, xmm7, xmm8
+vpcmpeqb xmm15, xmm7, xmm15
+vpcmpeqb xmm15, xmm8, xmm0
+vpcmpeqb xmm15, xmm8, xmm7
+vpcmpeqb xmm15, xmm8, xmm8
+vpcmpeqb xmm15, xmm8, xmm15
+vpcmpeqb xmm15, xmm15, xmm0
+vpcmpeqb xmm15, xmm15, xmm7
+vpcmpeqb xmm15, xmm15, xmm8
+vpcmpeqb xmm15, xmm15, xmm15
+vpcmpeqb xmm15, xmm6, [rdi]
+vpcmpeqb xmm15, xmm6, [r13]
+vpcmpeqb xmm15, xmm6, [rsp+8]
+vpcmpeqb xmm15, xmm6, [r12+r9*4-200]
+vpcmpeqb xmm15, xmm6, [rbp+rcx*8]
+vpcmpeqb xmm15, xmm6, [rax*2+16]
+vpcmpeqb xmm15, xmm6, [rip+data+4]
+vpcmpeqb xmm15, xmm6, [rip+data]
+vpcmpeqb xmm15, xmm6, [rip+64]
+vpcmpeqb xmm15, xmm6, [rbx-8]
+vpcmpeqb ymm0, ymm0, ymm0
+vpcmpeqb ymm0, ymm0, ymm7
+vpcmpeqb ymm0, ymm0, ymm8
+vpcmpeqb ymm0, ymm0, ymm15
+vpcmpeqb ymm0, ymm7, ymm0
+vpcmpeqb ymm0, ymm7, ymm7
+vpcmpeqb ymm0, ymm7, ymm8
+vpcmpeqb ymm0, ymm7, ymm15
+vpcmpeqb ymm0, ymm8, ymm0
+vpcmpeqb ymm0, ymm8, ymm7
+vpcmpeqb ymm0, ymm8, ymm8
+vpcmpeqb ymm0, ymm8, ymm15
+vpcmpeqb ymm0, ymm15, ymm0
+vpcmpeqb ymm0, ymm15, ymm7
+vpcmpeqb ymm0, ymm15, ymm8
+vpcmpeqb ymm0, ymm15, ymm15
+vpcmpeqb ymm0, ymm7, [rdi]
+vpcmpeqb ymm0, ymm7, [r13]
+vpcmpeqb ymm0, ymm7, [rsp+8]
+vpcmpeqb ymm0, ymm7, [r12+r9*4-200]
+vpcmpeqb ymm0, ymm7, [rbp+rcx*8]
+vpcmpeqb ymm0, ymm7, [rax*2+16]
+vpcmpeqb ymm0, ymm7, [rip+data+4]
+vpcmpeqb ymm0, ymm7, [rip+data]
+vpcmpeqb ymm0, ymm7, [rip+64]
+vpcmpeqb ymm0, ymm7, [rbx-8]
+vpcmpeqb ymm7, ymm0, ymm0
+vpcmpeqb ymm7, ymm0, ymm7
+vpcmpeqb ymm7, ymm0, ymm8
+vpcmpeqb ymm7, ymm0, ymm15
+vpcmpeqb ymm7, ymm7, ymm0
+vpcmpeqb ymm7, ymm7, ymm7
+vpcmpeqb ymm7, ymm7, ymm8
+vpcmpeqb ymm7, ymm7, ymm15
+vpcmpeqb ymm7, ymm8, ymm0
+vpcmpeqb ymm7, ymm8, ymm7
+vpcmpeqb ymm7, ymm8, ymm8
+vpcmpeqb ymm7, ymm8, ymm15
+vpcmpeqb ymm7, ymm15, ymm0
+vpcmpeqb ymm7, ymm15, ymm7
+vpcmpeqb ymm7, ymm15, ymm8
+vpcmpeqb ymm7, ymm15, ymm15
+vpcmpeqb ymm7, ymm14, [rdi]
+vpcmpeqb ymm7, ymm14, [r13]
+vpcmpeqb ymm7, ymm14, [rsp+8]
+vpcmpeqb ymm7, ymm14, [r12+r9*4-200]
+vpcmpeqb ymm7, ymm14, [rbp+rcx*8]
+vpcmpeqb ymm7, ymm14, [rax*2+16]
+vpcmpeqb ymm7, ymm14, [rip+data+4]
+vpcmpeqb ymm7, ymm14, [rip+data]
+vpcmpeqb ymm7, ymm14, [rip+64]
+vpcmpeqb ymm7, ymm14, [rbx-8]
+vpcmpeqb ymm8, ymm0, ymm0
+vpcmpeqb ymm8, ymm0, ymm7
+vpcmpeqb ymm8, ymm0, ymm8
+vpcmpeqb ymm8, ymm0, ymm15
+vpcmpeqb ymm8, ymm7, ymm0
+vpcmpeqb ymm8, ymm7, ymm7
+vpcmpeqb ymm8, ymm7, ymm8
+vpcmpeqb ymm8, ymm7, ymm15
+vpcmpeqb ymm8, ymm8, ymm0
+vpcmpeqb ymm8, ymm8, ymm7
+vpcmpeqb ymm8, ymm8, ymm8
+vpcmpeqb ymm8, ymm8, ymm15
+vpcmpeqb ymm8, ymm15, ymm0
+vpcmpeqb ymm8, ymm15, ymm7
+vpcmpeqb ymm8, ymm15, ymm8
+vpcmpeqb ymm8, ymm15, ymm15
+vpcmpeqb ymm8, ymm15, [rdi]
+vpcmpeqb ymm8, ymm15, [r13]
+vpcmpeqb ymm8, ymm15, [rsp+8]
+vpcmpeqb ymm8, ymm15, [r12+r9*4-200]
+vpcmpeqb ymm8, ymm15, [rbp+rcx*8]
+vpcmpeqb ymm8, ymm15, [rax*2+16]
+vpcmpeqb ymm8, ymm15, [rip+data+4]
+vpcmpeqb ymm8, ymm15, [rip+data]
+vpcmpeqb ymm8, ymm15, [rip+64]
+vpcmpeqb ymm8, ymm15, [rbx-8]
+vpcmpeqb ymm15, ymm0, ymm0
+vpcmpeqb ymm15, ymm0, ymm7
+vpcmpeqb ymm15, ymm0, ymm8
+vpcmpeqb ymm15, ymm0, ymm15
+vpcmpeqb ymm15, ymm7, ymm0
+vpcmpeqb ymm15, ymm7, ymm7
+vpcmpeqb ymm15, ymm7, ymm8
+vpcmpeqb ymm15, ymm7, ymm15
+vpcmpeqb ymm15, ymm8, ymm0
+vpcmpeqb ymm15, ymm8, ymm7
+vpcmpeqb ymm15, ymm8, ymm8
+vpcmpeqb ymm15, ymm8, ymm15
+vpcmpeqb ymm15, ymm15, ymm0
+vpcmpeqb ymm15, ymm15, ymm7
+vpcmpeqb ymm15, ymm15, ymm8
+vpcmpeqb ymm15, ymm15, ymm15
+vpcmpeqb ymm15, ymm6, [rdi]
+vpcmpeqb ymm15, ymm6, [r13]
+vpcmpeqb ymm15, ymm6, [rsp+8]
+vpcmpeqb ymm15, ymm6, [r12+r9*4-200]
+vpcmpeqb ymm15, ymm6, [rbp+rcx*8]
+vpcmpeqb ymm15, ymm6, [rax*2+16]
+vpcmpeqb ymm15, ymm6, [rip+data+4]
+vpcmpeqb ymm15, ymm6, [rip+data]
+vpcmpeqb ymm15, ymm6, [rip+64]
+vpcmpeqb ymm15, ymm6, [rbx-8]
+vfmadd132ps xmm0, xmm0, xmm0
+vfmadd132ps xmm0, xmm0, xmm7
+vfmadd132ps xmm0, xmm0, xmm8
+vfmadd132ps xmm0, xmm0, xmm15
+vfmadd132ps xmm0, xmm7, xmm0
+vfmadd132ps xmm0, xmm7, xmm7
+vfmadd132ps xmm0, xmm7, xmm8
+vfmadd132ps xmm0, xmm7, xmm15
+vfmadd132ps xmm0, xmm8, xmm0
+vfmadd132ps xmm0, xmm8, xmm7
+vfmadd132ps xmm0, xmm8, xmm8
+vfmadd132ps xmm0, xmm8, xmm15
+vfmadd132ps xmm0, xmm15, xmm0
+vfmadd132ps xmm0, xmm15, xmm7
+vfmadd132ps xmm0, xmm15, xmm8
+vfmadd132ps xmm0, xmm15, xmm15
+vfmadd132ps xmm0, xmm7, [rdi]
+vfmadd132ps xmm0, xmm7, [r13]
+vfmadd132ps xmm0, xmm7, [rsp+8]
+vfmadd132ps xmm0, xmm7, [r12+r9*4-200]
+vfmadd132ps xmm0, xmm7, [rbp+rcx*8]
+vfmadd132ps xmm0, xmm7, [rax*2+16]
+vfmadd132ps xmm0, xmm7, [rip+data+4]
+vfmadd132ps xmm0, xmm7, [rip+data]
+vfmadd132ps xmm0, xmm7, [rip+64]
+vfmadd132ps xmm0, xmm7, [rbx-8]
+vfmadd132ps xmm7, xmm0, xmm0
+vfmadd132ps xmm7, xmm0, xmm7
+vfmadd132ps xmm7, xmm0, xmm8
+vfmadd132ps xmm7, xmm0, xmm15
+vfmadd132ps xmm7, xmm7, xmm0
+vfmadd132ps xmm7, xmm7, xmm7
+vfmadd132ps xmm7, xmm7, xmm8
+vfmadd132ps xmm7, xmm7, xmm15
+vfmadd132ps xmm7, xmm8, xmm0
+vfmadd132ps xmm7, xmm8, xmm7
+vfmadd132ps xmm7, xmm8, xmm8
+vfmadd132ps xmm7, xmm8, xmm15
+vfmadd132ps xmm7, xmm15, xmm0
+vfmadd132ps xmm7, xmm15, xmm7
+vfmadd132ps xmm7, xmm15, xmm8
+vfmadd132ps xmm7, xmm15, xmm15
+vfmadd132ps xmm7, xmm14, [rdi]
+vfmadd132ps xmm7, xmm14, [r13]
+vfmadd132ps xmm7, xmm14, [rsp+8]
+vfmadd132ps xmm7, xmm14, [r12+r9*4-200]
+vfmadd132ps xmm7, xmm14, [rbp+rcx*8]
+vfmadd132ps xmm7, xmm14, [rax*2+16]
+vfmadd132ps xmm7, xmm14, [rip+data+4]
+vfmadd132ps xmm7, xmm14, [rip+data]
+vfmadd132ps xmm7, xmm14, [rip+64]
+vfmadd132ps xmm7, xmm14, [rbx-8]
+vfmadd132ps xmm8, xmm0, xmm0
+vfmadd132ps xmm8, xmm0, xmm7
+vfmadd132ps xmm8, xmm0, xmm8
+vfmadd132ps xmm8, xmm0, xmm15
+vfmadd132ps xmm8, xmm7, xmm0
+vfmadd132ps xmm8, xmm7, xmm7
+vfmadd132ps xmm8, xmm7, xmm8
+vfmadd132ps xmm8, xmm7, xmm15
+vfmadd132ps xmm8, xmm8, xmm0
+vfmadd132ps xmm8, xmm8, xmm7
+vfmadd132ps xmm8, xmm8, xmm8
+vfmadd132ps xmm8, xmm8, xmm15
+vfmadd132ps xmm8, xmm15, xmm0
+vfmadd132ps xmm8, xmm15, xmm7
+vfmadd132ps xmm8, xmm15, xmm8
+vfmadd132ps xmm8, xmm15, xmm15
+vfmadd132ps xmm8, xmm15, [rdi]
+vfmadd132ps xmm8, xmm15, [r13]
+vfmadd132ps xmm8, xmm15, [rsp+8]
+vfmadd132ps xmm8, xmm15, [r12+r9*4-200]
+vfmadd132ps xmm8, xmm15, [rbp+rcx*8]
+vfmadd132ps xmm8, xmm15, [rax*2+16]
+vfmadd132ps xmm8, xmm15, [rip+data+4]
+vfmadd132ps xmm8, xmm15, [rip+data]
+vfmadd132ps xmm8, xmm15, [rip+64]
+vfmadd132ps xmm8, xmm15, [rbx-8]
+vfmadd132ps xmm15, xmm0, xmm0
+vfmadd132ps xmm15, xmm0, xmm7
+vfmadd132ps xmm15, xmm0, xmm8
+vfmadd132ps xmm15, xmm0, xmm15
+vfmadd132ps xmm15, xmm7, xmm0
+vfmadd132ps xmm15, xmm7, xmm7
+vfmadd132ps xmm15, xmm7, xmm8
+vfmadd132ps xmm15, xmm7, xmm15
+vfmadd132ps xmm15, xmm8, xmm0
+vfmadd132ps xmm15, xmm8, xmm7
+vfmadd132ps xmm15, xmm8, xmm8
+vfmadd132ps xmm15, xmm8, xmm15
+vfmadd132ps xmm15, xmm15, xmm0
+vfmadd132ps xmm15, xmm15, xmm7
+vfmadd132ps xmm15, xmm15, xmm8
+vfmadd132ps xmm15, xmm15, xmm15
+vfmadd132ps xmm15, xmm6, [rdi]
+vfmadd132ps xmm15, xmm6, [r13]
+vfmadd132ps xmm15, xmm6, [rsp+8]
+vfmadd132ps xmm15, xmm6, [r12+r9*4-200]
+vfmadd132ps xmm15, xmm6, [rbp+rcx*8]
+vfmadd132ps xmm15, xmm6, [rax*2+16]
+vfmadd132ps xmm15, xmm6, [rip+data+4]
+vfmadd132ps xmm15, xmm6, [rip+data]
+vfmadd132ps xmm15, xmm6, [rip+64]
+vfmadd132ps xmm15, xmm6, [rbx-8]
+vfmadd132ps ymm0, ymm0, ymm0
+vfmadd132ps ymm0, ymm0, ymm7
+vfmadd132ps ymm0, ymm0, ymm8
+vfmadd132ps ymm0, ymm0, ymm15
+vfmadd132ps ymm0, ymm7, ymm0
+vfmadd132ps ymm0, ymm7, ymm7
+vfmadd132ps ymm0, ymm7, ymm8
+vfmadd132ps ymm0, ymm7, ymm15
+vfmadd132ps ymm0, ymm8, ymm0
+vfmadd132ps ymm0, ymm8, ymm7
+vfmadd132ps ymm0, ymm8, ymm8
+vfmadd132ps ymm0, ymm8, ymm15
+vfmadd132ps ymm0, ymm15, ymm0
+vfmadd132ps ymm0, ymm15, ymm7
+vfmadd132ps ymm0, ymm15, ymm8
+vfmadd132ps ymm0, ymm15, ymm15
+vfmadd132ps ymm0, ymm7, [rdi]
+vfmadd132ps ymm0, ymm7, [r13]
+vfmadd132ps ymm0, ymm7, [rsp+8]
+vfmadd132ps ymm0, ymm7, [r12+r9*4-200]
+vfmadd132ps ymm0, ymm7, [rbp+rcx*8]
+vfmadd132ps ymm0, ymm7, [rax*2+16]
+vfmadd132ps ymm0, ymm7, [rip+data+4]
+vfmadd132ps ymm0, ymm7, [rip+data]
+vfmadd132ps ymm0, ymm7, [rip+64]
+vfmadd132ps ymm0, ymm7, [rbx-8]
+vfmadd132ps ymm7, ymm0, ymm0
+vfmadd132ps ymm7, ymm0, ymm7
+vfmadd132ps ymm7, ymm0, ymm8
+vfmadd132ps ymm7, ymm0, ymm15
+vfmadd132ps ymm7, ymm7, ymm0
+vfmadd132ps ymm7, ymm7, ymm7
+vfmadd132ps ymm7, ymm7, ymm8
+vfmadd132ps ymm7, ymm7, ymm15
+vfmadd132ps ymm7, ymm8, ymm0
+vfmadd132ps ymm7, ymm8, ymm7
+vfmadd132ps ymm7, ymm8, ymm8
+vfmadd132ps ymm7, ymm8, ymm15
+vfmadd132ps ymm7, ymm15, ymm0
+vfmadd132ps ymm7, ymm15, ymm7
+vfmadd132ps ymm7, ymm15, ymm8
+vfmadd132ps ymm7, ymm15, ymm15
+vfmadd132ps ymm7, ymm14, [rdi]
+vfmadd132ps ymm7, ymm14, [r13]
+vfmadd132ps ymm7, ymm14, [rsp+8]
+vfmadd132ps ymm7, ymm14, [r12+r9*4-200]
+vfmadd132ps ymm7, ymm14, [rbp+rcx*8]
+vfmadd132ps ymm7, ymm14, [rax*2+16]
+vfmadd132ps ymm7, ymm14, [rip+data+4]
+vfmadd132ps ymm7, ymm14, [rip+data]
+vfmadd132ps ymm7, ymm14, [rip+64]
+vfmadd132ps ymm7, ymm14, [rbx-8]
+vfmadd132ps ymm8, ymm0, ymm0
+vfmadd132ps ymm8, ymm0, ymm7
+vfmadd132ps ymm8, ymm0, ymm8
+vfmadd132ps ymm8, ymm0, ymm15
+vfmadd132ps ymm8, ymm7, ymm0
+vfmadd132ps ymm8, ymm7, ymm7
+vfmadd132ps ymm8, ymm7, ymm8
+vfmadd132ps ymm8, ymm7, ymm15
+vfmadd132ps ymm8, ymm8, ymm0
+vfmadd132ps ymm8, ymm8, ymm7
+vfmadd132ps ymm8, ymm8, ymm8
+vfmadd132ps ymm8, ymm8, ymm15
+vfmadd132ps ymm8, ymm15, ymm0
+vfmadd132ps ymm8, ymm15, ymm7
+vfmadd132ps ymm8, ymm15, ymm8
+vfmadd132ps ymm8, ymm15, ymm15
+vfmadd132ps ymm8, ymm15, [rdi]
+vfmadd132ps ymm8, ymm15, [r13]
+vfmadd132ps ymm8, ymm15, [rsp+8]
+vfmadd132ps ymm8, ymm15, [r12+r9*4-200]
+vfmadd132ps ymm8, ymm15, [rbp+rcx*8]
+vfmadd132ps ymm8, ymm15, [rax*2+16]
+vfmadd132ps ymm8, ymm15, [rip+data+4]
+vfmadd132ps ymm8, ymm15, [rip+data]
+vfmadd132ps ymm8, ymm15, [rip+64]
+vfmadd132ps ymm8, ymm15, [rbx-8]
+vfmadd132ps ymm15, ymm0, ymm0
+vfmadd132ps ymm15, ymm0, ymm7
+vfmadd132ps ymm15, ymm0, ymm8
+vfmadd132ps ymm15, ymm0, ymm15
+vfmadd132ps ymm15, ymm7, ymm0
+vfmadd132ps ymm15, ymm7, ymm7
+vfmadd132ps ymm15, ymm7, ymm8
+vfmadd132ps ymm15, ymm7, ymm15
+vfmadd132ps ymm15, ymm8, ymm0
+vfmadd132ps ymm15, ymm8, ymm7
+vfmadd132ps ymm15, ymm8, ymm8
+vfmadd132ps ymm15, ymm8, ymm15
+vfmadd132ps ymm15, ymm15, ymm0
+vfmadd132ps ymm15, ymm15, ymm7
+vfmadd132ps ymm15, ymm15, ymm8
+vfmadd132ps ymm15, ymm15, ymm15
+vfmadd132ps ymm15, ymm6, [rdi]
+vfmadd132ps ymm15, ymm6, [r13]
+vfmadd132ps ymm15, ymm6, [rsp+8]
+vfmadd132ps ymm15, ymm6, [r12+r9*4-200]
+vfmadd132ps ymm15, ymm6, [rbp+rcx*8]
+vfmadd132ps ymm15, ymm6, [rax*2+16]
+vfmadd132ps ymm15, ymm6, [rip+data+4]
+vfmadd132ps ymm15, ymm6, [rip+data]
+vfmadd132ps ymm15, ymm6, [rip+64]
+vfmadd132ps ymm15, ymm6, [rbx-8]
+vfmadd213ps xmm0, xmm0, xmm0
+vfmadd213ps xmm0, xmm0, xmm7
+vfmadd213ps xmm0, xmm0, xmm8
+vfmadd213ps xmm0, xmm0, xmm15
+vfmadd213ps xmm0, xmm7, xmm0
+vfmadd213ps xmm0, xmm7, xmm7
+vfmadd213ps xmm0, xmm7, xmm8
+vfmadd213ps xmm0, xmm7, xmm15
+vfmadd213ps xmm0, xmm8, xmm0
+vfmadd213ps xmm0, xmm8, xmm7
+vfmadd213ps xmm0, xmm8, xmm8
+vfmadd213ps xmm0, xmm8, xmm15
+vfmadd213ps xmm0, xmm15, xmm0
+vfmadd213ps xmm0, xmm15, xmm7
+vfmadd213ps xmm0, xmm15, xmm8
+vfmadd213ps xmm0, xmm15, xmm15
+vfmadd213ps xmm0, xmm7, [rdi]
+vfmadd213ps xmm0, xmm7, [r13]
+vfmadd213ps xmm0, xmm7, [rsp+8]
+vfmadd213ps xmm0, xmm7, [r12+r9*4-200]
+vfmadd213ps xmm0, xmm7, [rbp+rcx*8]
+vfmadd213ps xmm0, xmm7, [rax*2+16]
+vfmadd213ps xmm0, xmm7, [rip+data+4]
+vfmadd213ps xmm0, xmm7, [rip+data]
+vfmadd213ps xmm0, xmm7, [rip+64]
+vfmadd213ps xmm0, xmm7, [rbx-8]
+vfmadd213ps xmm7, xmm0, xmm0
+vfmadd213ps xmm7, xmm0, xmm7
+vfmadd213ps xmm7, xmm0, xmm8
+vfmadd213ps xmm7, xmm0, xmm15
+vfmadd213ps xmm7, xmm7, xmm0
+vfmadd213ps xmm7, xmm7, xmm7
+vfmadd213ps xmm7, xmm7, xmm8
+vfmadd213ps xmm7, xmm7, xmm15
+vfmadd213ps xmm7, xmm8, xmm0
+vfmadd213ps xmm7, xmm8, xmm7
+vfmadd213ps xmm7, xmm8, xmm8
+vfmadd213ps xmm7, xmm8, xmm15
+vfmadd213ps xmm7, xmm15, xmm0
+vfmadd213ps xmm7, xmm15, xmm7
+vfmadd213ps xmm7, xmm15, xmm8
+vfmadd213ps xmm7, xmm15, xmm15
+vfmadd213ps xmm7, xmm14, [rdi]
+vfmadd213ps xmm7, xmm14, [r13]
+vfmadd213ps xmm7, xmm14, [rsp+8]
+vfmadd213ps xmm7, xmm14, [r12+r9*4-200]
+vfmadd213ps xmm7, xmm14, [rbp+rcx*8]
+vfmadd213ps xmm7, xmm14, [rax*2+16]
+vfmadd213ps xmm7, xmm14, [rip+data+4]
+vfmadd213ps xmm7, xmm14, [rip+data]
+vfmadd213ps xmm7, xmm14, [rip+64]
+vfmadd213ps xmm7, xmm14, [rbx-8]
+vfmadd213ps xmm8, xmm0, xmm0
+vfmadd213ps xmm8, xmm0, xmm7
+vfmadd213ps xmm8, xmm0, xmm8
+vfmadd213ps xmm8, xmm0, xmm15
+vfmadd213ps xmm8, xmm7, xmm0
+vfmadd213ps xmm8, xmm7, xmm7
+vfmadd213ps xmm8, xmm7, xmm8
+vfmadd213ps xmm8, xmm7, xmm15
+vfmadd213ps xmm8, xmm8, xmm0
+vfmadd213ps xmm8, xmm8, xmm7
+vfmadd213ps xmm8, xmm8, xmm8
+vfmadd213ps xmm8, xmm8, xmm15
+vfmadd213ps xmm8, xmm15, xmm0
+vfmadd213ps xmm8, xmm15, xmm7
+vfmadd213ps xmm8, xmm15, xmm8
+vfmadd213ps xmm8, xmm15, xmm15
+vfmadd213ps xmm8, xmm15, [rdi]
+vfmadd213ps xmm8, xmm15, [r13]
+vfmadd213ps xmm8, xmm15, [rsp+8]
+vfmadd213ps xmm8, xmm15, [r12+r9*4-200]
+vfmadd213ps xmm8, xmm15, [rbp+rcx*8]
+vfmadd213ps xmm8, xmm15, [rax*2+16]
+vfmadd213ps xmm8, xmm15, [rip+data+4]
+vfmadd213ps xmm8, xmm15, [rip+data]
+vfmadd213ps xmm8, xmm15, [rip+64]
+vfmadd213ps xmm8, xmm15, [rbx-8]
+vfmadd213ps xmm15, xmm0, xmm0
+vfmadd213ps xmm15, xmm0, xmm7
+vfmadd213ps xmm15, xmm0, xmm8
+vfmadd213ps xmm15, xmm0, xmm15
+vfmadd213ps xmm15, xmm7, xmm0
+vfmadd213ps xmm15, xmm7, xmm7
+vfmadd213ps xmm15, xmm7, xmm8
+vfmadd213ps xmm15, xmm7, xmm15
+vfmadd213ps xmm15, xmm8, xmm0
+vfmadd213ps xmm15, xmm8, xmm7
+vfmadd213ps xmm15, xmm8, xmm8
+vfmadd213ps xmm15, xmm8, xmm15
+vfmadd213ps xmm15, xmm15, xmm0
+vfmadd213ps xmm15, xmm15, xmm7
+vfmadd213ps xmm15, xmm15, xmm8
+vfmadd213ps xmm15, xmm15, xmm15
+vfmadd213ps xmm15, xmm6, [rdi]
+vfmadd213ps xmm15, xmm6, [r13]
+vfmadd213ps xmm15, xmm6, [rsp+8]
+vfmadd213ps xmm15, xmm6, [r12+r9*4-200]
+vfmadd213ps xmm15, xmm6, [rbp+rcx*8]
+vfmadd213ps xmm15, xmm6, [rax*2+16]
+vfmadd213ps xmm15, xmm6, [rip+data+4]
+vfmadd213ps xmm15, xmm6, [rip+data]
+vfmadd213ps xmm15, xmm6, [rip+64]
+vfmadd213ps xmm15, xmm6, [rbx-8]
+vfmadd213ps ymm0, ymm0, ymm0
+vfmadd213ps ymm0, ymm0, ymm7
+vfmadd213ps ymm0, ymm0, ymm8
+vfmadd213ps ymm0, ymm0, ymm15
+vfmadd213ps ymm0, ymm7, ymm0
+vfmadd213ps ymm0, ymm7, ymm7
+vfmadd213ps ymm0, ymm7, ymm8
+vfmadd213ps ymm0, ymm7, ymm15
+vfmadd213ps ymm0, ymm8, ymm0
+vfmadd213ps ymm0, ymm8, ymm7
+vfmadd213ps ymm0, ymm8, ymm8
+vfmadd213ps ymm0, ymm8, ymm15
+vfmadd213ps ymm0, ymm15, ymm0
+vfmadd213ps ymm0, ymm15, ymm7
+vfmadd213ps ymm0, ymm15, ymm8
+vfmadd213ps ymm0, ymm15, ymm15
+vfmadd213ps ymm0, ymm7, [rdi]
+vfmadd213ps ymm0, ymm7, [r13]
+vfmadd213ps ymm0, ymm7, [rsp+8]
+vfmadd213ps ymm0, ymm7, [r12+r9*4-200]
+vfmadd213ps ymm0, ymm7, [rbp+rcx*8]
+vfmadd213ps ymm0, ymm7, [rax*2+16]
+vfmadd213ps ymm0, ymm7, [rip+data+4]
+vfmadd213ps ymm0, ymm7, [rip+data]
+vfmadd213ps ymm0, ymm7, [rip+64]
+vfmadd213ps ymm0, ymm7, [rbx-8]
+vfmadd213ps ymm7, ymm0, ymm0
+vfmadd213ps ymm7, ymm0, ymm7
+vfmadd213ps ymm7, ymm0, ymm8
+vfmadd213ps ymm7, ymm0, ymm15
+vfmadd213ps ymm7, ymm7, ymm0
+vfmadd213ps ymm7, ymm7, ymm7
+vfmadd213ps ymm7, ymm7, ymm8
+vfmadd213ps ymm7, ymm7, ymm15
+vfmadd213ps ymm7, ymm8, ymm0
+vfmadd213ps ymm7, ymm8, ymm7
+vfmadd213ps ymm7, ymm8, ymm8
+vfmadd213ps ymm7, ymm8, ymm15
+vfmadd213ps ymm7, ymm15, ymm0
+vfmadd213ps ymm7, ymm15, ymm7
+vfmadd213ps ymm7, ymm15, ymm8
+vfmadd213ps ymm7, ymm15, ymm15
+vfmadd213ps ymm7, ymm14, [rdi]
+vfmadd213ps ymm7, ymm14, [r13]
+vfmadd213ps ymm7, ymm14, [rsp+8]
+vfmadd213ps ymm7, ymm14, [r12+r9*4-200]
+vfmadd213ps ymm7, ymm14, [rbp+rcx*8]
+vfmadd213ps ymm7, ymm14, [rax*2+16]
+vfmadd213ps ymm7, ymm14, [rip+data+4]
+vfmadd213ps ymm7, ymm14, [rip+data]
+vfmadd213ps ymm7, ymm14, [rip+64]
+vfmadd213ps ymm7, ymm14, [rbx-8]
+vfmadd213ps ymm8, ymm0, ymm0
+vfmadd213ps ymm8, ymm0, ymm7
+vfmadd213ps ymm8, ymm0, ymm8
+vfmadd213ps ymm8, ymm0, ymm15
+vfmadd213ps ymm8, ymm7, ymm0
+vfmadd213ps ymm8, ymm7, ymm7
+vfmadd213ps ymm8, ymm7, ymm8
+vfmadd213ps ymm8, ymm7, ymm15
+vfmadd213ps ymm8, ymm8, ymm0
+vfmadd213ps ymm8, ymm8, ymm7
+vfmadd213ps ymm8, ymm8, ymm8
+vfmadd213ps ymm8, ymm8, ymm15
+vfmadd213ps ymm8, ymm15, ymm0
+vfmadd213ps ymm8, ymm15, ymm7
+vfmadd213ps ymm8, ymm15, ymm8
+vfmadd213ps ymm8, ymm15, ymm15
+vfmadd213ps ymm8, ymm15, [rdi]
+vfmadd213ps ymm8, ymm15, [r13]
+vfmadd213ps ymm8, ymm15, [rsp+8]
+vfmadd213ps ymm8, ymm15, [r12+r9*4-200]
+vfmadd213ps ymm8, ymm15, [rbp+rcx*8]
+vfmadd213ps ymm8, ymm15, [rax*2+16]
+vfmadd213ps ymm8, ymm15, [rip+data+4]
+vfmadd213ps ymm8, ymm15, [rip+data]
+vfmadd213ps ymm8, ymm15, [rip+64]
+vfmadd213ps ymm8, ymm15, [rbx-8]
+vfmadd213ps ymm15, ymm0, ymm0
+vfmadd213ps ymm15, ymm0, ymm7
+vfmadd213ps ymm15, ymm0, ymm8
+vfmadd213ps ymm15, ymm0, ymm15
+vfmadd213ps ymm15, ymm7, ymm0
+vfmadd213ps ymm15, ymm7, ymm7
+vfmadd213ps ymm15, ymm7, ymm8
+vfmadd213ps ymm15, ymm7, ymm15
+vfmadd213ps ymm15, ymm8, ymm0
+vfmadd213ps ymm15, ymm8, ymm7
+vfmadd213ps ymm15, ymm8, ymm8
+vfmadd213ps ymm15, ymm8, ymm15
+vfmadd213ps ymm15, ymm15, ymm0
+vfmadd213ps ymm15, ymm15, ymm7
+vfmadd213ps ymm15, ymm15, ymm8
+vfmadd213ps ymm15, ymm15, ymm15
+vfmadd213ps ymm15, ymm6, [rdi]
+vfmadd213ps ymm15, ymm6, [r13]
+vfmadd213ps ymm15, ymm6, [rsp+8]
+vfmadd213ps ymm15, ymm6, [r12+r9*4-200]
+vfmadd213ps ymm15, ymm6, [rbp+rcx*8]
+vfmadd213ps ymm15, ymm6, [rax*2+16]
+vfmadd213ps ymm15, ymm6, [rip+data+4]
+vfmadd213ps ymm15, ymm6, [rip+data]
+vfmadd213ps ymm15, ymm6, [rip+64]
+vfmadd213ps ymm15, ymm6, [rbx-8]
+vfmadd231ps xmm0, xmm0, xmm0
+vfmadd231ps xmm0, xmm0, xmm7
+vfmadd231ps xmm0, xmm0, xmm8
+vfmadd231ps xmm0, xmm0, xmm15
+vfmadd231ps xmm0, xmm7, xmm0
+vfmadd231ps xmm0, xmm7, xmm7
+vfmadd231ps xmm0, xmm7, xmm8
+vfmadd231ps xmm0, xmm7, xmm15
+vfmadd231ps xmm0, xmm8, xmm0
+vfmadd231ps xmm0, xmm8, xmm7
+vfmadd231ps xmm0, xmm8, xmm8
+vfmadd231ps xmm0, xmm8, xmm15
+vfmadd231ps xmm0, xmm15, xmm0
+vfmadd231ps xmm0, xmm15, xmm7
+vfmadd231ps xmm0, xmm15, xmm8
+vfmadd231ps xmm0, xmm15, xmm15
+vfmadd231ps xmm0, xmm7, [rdi]
+vfmadd231ps xmm0, xmm7, [r13]
+vfmadd231ps xmm0, xmm7, [rsp+8]
+vfmadd231ps xmm0, xmm7, [r12+r9*4-200]
+vfmadd231ps xmm0, xmm7, [rbp+rcx*8]
+vfmadd231ps xmm0, xmm7, [rax*2+16]
+vfmadd231ps xmm0, xmm7, [rip+data+4]
+vfmadd231ps xmm0, xmm7, [rip+data]
+vfmadd231ps xmm0, xmm7, [rip+64]
+vfmadd231ps xmm0, xmm7, [rbx-8]
+vfmadd231ps xmm7, xmm0, xmm0
+vfmadd231ps xmm7, xmm0, xmm7
+vfmadd231ps xmm7, xmm0, xmm8
+vfmadd231ps xmm7, xmm0, xmm15
+vfmadd231ps xmm7, xmm7, xmm0
+vfmadd231ps xmm7, xmm7, xmm7
+vfmadd231ps xmm7, xmm7, xmm8
+vfmadd231ps xmm7, xmm7, xmm15
+vfmadd231ps xmm7, xmm8, xmm0
+vfmadd231ps xmm7, xmm8, xmm7
+vfmadd231ps xmm7, xmm8, xmm8
+vfmadd231ps xmm7, xmm8, xmm15
+vfmadd231ps xmm7, xmm15, xmm0
+vfmadd231ps xmm7, xmm15, xmm7
+vfmadd231ps xmm7, xmm15, xmm8
+vfmadd231ps xmm7, xmm15, xmm15
+vfmadd231ps xmm7, xmm14, [rdi]
+vfmadd231ps xmm7, xmm14, [r13]
+vfmadd231ps xmm7, xmm14, [rsp+8]
+vfmadd231ps xmm7, xmm14, [r12+r9*4-200]
+vfmadd231ps xmm7, xmm14, [rbp+rcx*8]
+vfmadd231ps xmm7, xmm14, [rax*2+16]
+vfmadd231ps xmm7, xmm14, [rip+data+4]
+vfmadd231ps xmm7, xmm14, [rip+data]
+vfmadd231ps xmm7, xmm14, [rip+64]
+vfmadd231ps xmm7, xmm14, [rbx-8]
+vfmadd231ps xmm8, xmm0, xmm0
+vfmadd231ps xmm8, xmm0, xmm7
+vfmadd231ps xmm8, xmm0, xmm8
+vfmadd231ps xmm8, xmm0, xmm15
+vfmadd231ps xmm8, xmm7, xmm0
+vfmadd231ps xmm8, xmm7, xmm7
+vfmadd231ps xmm8, xmm7, xmm8
+vfmadd231ps xmm8, xmm7, xmm15
+vfmadd231ps xmm8, xmm8, xmm0
+vfmadd231ps xmm8, xmm8, xmm7
+vfmadd231ps xmm8, xmm8, xmm8
+vfmadd231ps xmm8, xmm8, xmm15
+vfmadd231ps xmm8, xmm15, xmm0
+vfmadd231ps xmm8, xmm15, xmm7
+vfmadd231ps xmm8, xmm15, xmm8
+vfmadd231ps xmm8, xmm15, xmm15
+vfmadd231ps xmm8, xmm15, [rdi]
+vfmadd231ps xmm8, xmm15, [r13]
+vfmadd231ps xmm8, xmm15, [rsp+8]
+vfmadd231ps xmm8, xmm15, [r12+r9*4-200]
+vfmadd231ps xmm8, xmm15, [rbp+rcx*8]
+vfmadd231ps xmm8, xmm15, [rax*2+16]
+vfmadd231ps xmm8, xmm15, [rip+data+4]
+vfmadd231ps xmm8, xmm15, [rip+data]
+vfmadd231ps xmm8, xmm15, [rip+64]
+vfmadd231ps xmm8, xmm15, [rbx-8]
+vfmadd231ps xmm15, xmm0, xmm0
+vfmadd231ps xmm15, xmm0, xmm7
+vfmadd231ps xmm15, xmm0, xmm8
+vfmadd231ps xmm15, xmm0, xmm15
+vfmadd231ps xmm15, xmm7, xmm0
+vfmadd231ps xmm15, xmm7, xmm7
+vfmadd231ps xmm15, xmm7, xmm8
+vfmadd231ps xmm15, xmm7, xmm15
+vfmadd231ps xmm15, xmm8, xmm0
+vfmadd231ps xmm15, xmm8, xmm7
+vfmadd231ps xmm15, xmm8, xmm8
+vfmadd231ps xmm15, xmm8, xmm15
+vfmadd231ps xmm15, xmm15, xmm0
+vfmadd231ps xmm15, xmm15, xmm7
+vfmadd231ps xmm15, xmm15, xmm8
+vfmadd231ps xmm15, xmm15, xmm15
+vfmadd231ps xmm15, xmm6, [rdi]
+vfmadd231ps xmm15, xmm6, [r13]
+vfmadd231ps xmm15, xmm6, [rsp+8]
+vfmadd231ps xmm15, xmm6, [r12+r9*4-200]
+vfmadd231ps xmm15, xmm6, [rbp+rcx*8]
+vfmadd231ps xmm15, xmm6, [rax*2+16]
+vfmadd231ps xmm15, xmm6, [rip+data+4]
+vfmadd231ps xmm15, xmm6, [rip+data]
+vfmadd231ps xmm15, xmm6, [rip+64]
+vfmadd231ps xmm15, xmm6, [rbx-8]
+vfmadd231ps ymm0, ymm0, ymm0
+vfmadd231ps ymm0, ymm0, ymm7
+vfmadd231ps ymm0, ymm0, ymm8
+vfmadd231ps ymm0, ymm0, ymm15
+vfmadd231ps ymm0, ymm7, ymm0
+vfmadd231ps ymm0, ymm7, ymm7
+vfmadd231ps ymm0, ymm7, ymm8
+vfmadd231ps ymm0, ymm7, ymm15
+vfmadd231ps ymm0, ymm8, ymm0
+vfmadd231ps ymm0, ymm8, ymm7
+vfmadd231ps ymm0, ymm8, ymm8
+vfmadd231ps ymm0, ymm8, ymm15
+vfmadd231ps ymm0, ymm15, ymm0
+vfmadd231ps ymm0, ymm15, ymm7
+vfmadd231ps ymm0, ymm15, ymm8
+vfmadd231ps ymm0, ymm15, ymm15
+vfmadd231ps ymm0, ymm7, [rdi]
+vfmadd231ps ymm0, ymm7, [r13]
+vfmadd231ps ymm0, ymm7, [rsp+8]
+vfmadd231ps ymm0, ymm7, [r12+r9*4-200]
+vfmadd231ps ymm0, ymm7, [rbp+rcx*8]
+vfmadd231ps ymm0, ymm7, [rax*2+16]
+vfmadd231ps ymm0, ymm7, [rip+data+4]
+vfmadd231ps ymm0, ymm7, [rip+data]
+vfmadd231ps ymm0, ymm7, [rip+64]
+vfmadd231ps ymm0, ymm7, [rbx-8]
+vfmadd231ps ymm7, ymm0, ymm0
+vfmadd231ps ymm7, ymm0, ymm7
+vfmadd231ps ymm7, ymm0, ymm8
+vfmadd231ps ymm7, ymm0, ymm15
+vfmadd231ps ymm7, ymm7, ymm0
+vfmadd231ps ymm7, ymm7, ymm7
+vfmadd231ps ymm7, ymm7, ymm8
+vfmadd231ps ymm7, ymm7, ymm15
+vfmadd231ps ymm7, ymm8, ymm0
+vfmadd231ps ymm7, ymm8, ymm7
+vfmadd231ps ymm7, ymm8, ymm8
+vfmadd231ps ymm7, ymm8, ymm15
+vfmadd231ps ymm7, ymm15, ymm0
+vfmadd231ps ymm7, ymm15, ymm7
+vfmadd231ps ymm7, ymm15, ymm8
+vfmadd231ps ymm7, ymm15, ymm15
+vfmadd231ps ymm7, ymm14, [rdi]
+vfmadd231ps ymm7, ymm14, [r13]
+vfmadd231ps ymm7, ymm14, [rsp+8]
+vfmadd231ps ymm7, ymm14, [r12+r9*4-200]
+vfmadd231ps ymm7, ymm14, [rbp+rcx*8]
+vfmadd231ps ymm7, ymm14, [rax*2+16]
+vfmadd231ps ymm7, ymm14, [rip+data+4]
+vfmadd231ps ymm7, ymm14, [rip+data]
+vfmadd231ps ymm7, ymm14, [rip+64]
+vfmadd231ps ymm7, ymm14, [rbx-8]
+vfmadd231ps ymm8, ymm0, ymm0
+vfmadd231ps ymm8, ymm0, ymm7
+vfmadd231ps ymm8, ymm0, ymm8
+vfmadd231ps ymm8, ymm0, ymm15
+vfmadd231ps ymm8, ymm7, ymm0
+vfmadd231ps ymm8, ymm7, ymm7
+vfmadd231ps ymm8, ymm7, ymm8
+vfmadd231ps ymm8, ymm7, ymm15
+vfmadd231ps ymm8, ymm8, ymm0
+vfmadd231ps ymm8, ymm8, ymm7
+vfmadd231ps ymm8, ymm8, ymm8
+vfmadd231ps ymm8, ymm8, ymm15
+vfmadd231ps ymm8, ymm15, ymm0
+vfmadd231ps ymm8, ymm15, ymm7
+vfmadd231ps ymm8, ymm15, ymm8
+vfmadd231ps ymm8, ymm15, ymm15
+vfmadd231ps ymm8, ymm15, [rdi]
+vfmadd231ps ymm8, ymm15, [r13]
+vfmadd231ps ymm8, ymm15, [rsp+8]
+vfmadd231ps ymm8, ymm15, [r12+r9*4-200]
+vfmadd231ps ymm8, ymm15, [rbp+rcx*8]
+vfmadd231ps ymm8, ymm15, [rax*2+16]
+vfmadd231ps ymm8, ymm15, [rip+data+4]
+vfmadd231ps ymm8, ymm15, [rip+data]
+vfmadd231ps ymm8, ymm15, [rip+64]
+vfmadd231ps ymm8, ymm15, [rbx-8]
+vfmadd231ps ymm15, ymm0, ymm0
+vfmadd231ps ymm15, ymm0, ymm7
+vfmadd231ps ymm15, ymm0, ymm8
+vfmadd231ps ymm15, ymm0, ymm15
+vfmadd231ps ymm15, ymm7, ymm0
+vfmadd231ps ymm15, ymm7, ymm7
+vfmadd231ps ymm15, ymm7, ymm8
+vfmadd231ps ymm15, ymm7, ymm15
+vfmadd231ps ymm15, ymm8, ymm0
+vfmadd231ps ymm15, ymm8, ymm7
+vfmadd231ps ymm15, ymm8, ymm8
+vfmadd231ps ymm15, ymm8, ymm15
+vfmadd231ps ymm15, ymm15, ymm0
+vfmadd231ps ymm15, ymm15, ymm7
+vfmadd231ps ymm15, ymm15, ymm8
+vfmadd231ps ymm15, ymm15, ymm15
+vfmadd231ps ymm15, ymm6, [rdi]
+vfmadd231ps ymm15, ymm6, [r13]
+vfmadd231ps ymm15, ymm6, [rsp+8]
+vfmadd231ps ymm15, ymm6, [r12+r9*4-200]
+vfmadd231ps ymm15, ymm6, [rbp+rcx*8]
+vfmadd231ps ymm15, ymm6, [rax*2+16]
+vfmadd231ps ymm15, ymm6, [rip+data+4]
+vfmadd231ps ymm15, ymm6, [rip+data]
+vfmadd231ps ymm15, ymm6, [rip+64]
+vfmadd231ps ymm15, ymm6, [rbx-8]
+vfmadd231pd xmm0, xmm0, xmm0
+vfmadd231pd xmm0, xmm0, xmm7
+vfmadd231pd xmm0, xmm0, xmm8
+vfmadd231pd xmm0, xmm0, xmm15
+vfmadd231pd xmm0, xmm7, xmm0
+vfmadd231pd xmm0, xmm7, xmm7
+vfmadd231pd xmm0, xmm7, xmm8
+vfmadd231pd xmm0, xmm7, xmm15
+vfmadd231pd xmm0, xmm8, xmm0
+vfmadd231pd xmm0, xmm8, xmm7
+vfmadd231pd xmm0, xmm8, xmm8
+vfmadd231pd xmm0, xmm8, xmm15
+vfmadd231pd xmm0, xmm15, xmm0
+vfmadd231pd xmm0, xmm15, xmm7
+vfmadd231pd xmm0, xmm15, xmm8
+vfmadd231pd xmm0, xmm15, xmm15
+vfmadd231pd xmm0, xmm7, [rdi]
+vfmadd231pd xmm0, xmm7, [r13]
+vfmadd231pd xmm0, xmm7, [rsp+8]
+vfmadd231pd xmm0, xmm7, [r12+r9*4-200]
+vfmadd231pd xmm0, xmm7, [rbp+rcx*8]
+vfmadd231pd xmm0, xmm7, [rax*2+16]
+vfmadd231pd xmm0, xmm7, [rip+data+4]
+vfmadd231pd xmm0, xmm7, [rip+data]
+vfmadd231pd xmm0, xmm7, [rip+64]
+vfmadd231pd xmm0, xmm7, [rbx-8]
+vfmadd231pd xmm7, xmm0, xmm0
+vfmadd231pd xmm7, xmm0, xmm7
+vfmadd231pd xmm7, xmm0, xmm8
+vfmadd231pd xmm7, xmm0, xmm15
+vfmadd231pd xmm7, xmm7, xmm0
+vfmadd231pd xmm7, xmm7, xmm7
+vfmadd231pd xmm7, xmm7, xmm8
+vfmadd231pd xmm7, xmm7, xmm15
+vfmadd231pd xmm7, xmm8, xmm0
+vfmadd231pd xmm7, xmm8, xmm7
+vfmadd231pd xmm7, xmm8, xmm8
+vfmadd231pd xmm7, xmm8, xmm15
+vfmadd231pd xmm7, xmm15, xmm0
+vfmadd231pd xmm7, xmm15, xmm7
+vfmadd231pd xmm7, xmm15, xmm8
+vfmadd231pd xmm7, xmm15, xmm15
+vfmadd231pd xmm7, xmm14, [rdi]
+vfmadd231pd xmm7, xmm14, [r13]
+vfmadd231pd xmm7, xmm14, [rsp+8]
+vfmadd231pd xmm7, xmm14, [r12+r9*4-200]
+vfmadd231pd xmm7, xmm14, [rbp+rcx*8]
+vfmadd231pd xmm7, xmm14, [rax*2+16]
+vfmadd231pd xmm7, xmm14, [rip+data+4]
+vfmadd231pd xmm7, xmm14, [rip+data]
+vfmadd231pd xmm7, xmm14, [rip+64]
+vfmadd231pd xmm7, xmm14, [rbx-8]
+vfmadd231pd xmm8, xmm0, xmm0
+vfmadd231pd xmm8, xmm0, xmm7
+vfmadd231pd xmm8, xmm0, xmm8
+vfmadd231pd xmm8, xmm0, xmm15
+vfmadd231pd xmm8, xmm7, xmm0
+vfmadd231pd xmm8, xmm7, xmm7
+vfmadd231pd xmm8, xmm7, xmm8
+vfmadd231pd xmm8, xmm7, xmm15
+vfmadd231pd xmm8, xmm8, xmm0
+vfmadd231pd xmm8, xmm8, xmm7
+vfmadd231pd xmm8, xmm8, xmm8
+vfmadd231pd xmm8, xmm8, xmm15
+vfmadd231pd xmm8, xmm15, xmm0
+vfmadd231pd xmm8, xmm15, xmm7
+vfmadd231pd xmm8, xmm15, xmm8
+vfmadd231pd xmm8, xmm15, xmm15
+vfmadd231pd xmm8, xmm15, [rdi]
+vfmadd231pd xmm8, xmm15, [r13]
+vfmadd231pd xmm8, xmm15, [rsp+8]
+vfmadd231pd xmm8, xmm15, [r12+r9*4-200]
+vfmadd231pd xmm8, xmm15, [rbp+rcx*8]
+vfmadd231pd xmm8, xmm15, [rax*2+16]
+vfmadd231pd xmm8, xmm15, [rip+data+4]
+vfmadd231pd xmm8, xmm15, [rip+data]
+vfmadd231pd xmm8, xmm15, [rip+64]
+vfmadd231pd xmm8, xmm15, [rbx-8]
+vfmadd231pd xmm15, xmm0, xmm0
+vfmadd231pd xmm15, xmm0, xmm7
+vfmadd231pd xmm15, xmm0, xmm8
+vfmadd231pd xmm15, xmm0, xmm15
+vfmadd231pd xmm15, xmm7, xmm0
+vfmadd231pd xmm15, xmm7, xmm7
+vfmadd231pd xmm15, xmm7, xmm8
+vfmadd231pd xmm15, xmm7, xmm15
+vfmadd231pd xmm15, xmm8, xmm0
+vfmadd231pd xmm15, xmm8, xmm7
+vfmadd231pd xmm15, xmm8, xmm8
+vfmadd231pd xmm15, xmm8, xmm15
+vfmadd231pd xmm15, xmm15, xmm0
+vfmadd231pd xmm15, xmm15, xmm7
+vfmadd231pd xmm15, xmm15, xmm8
+vfmadd231pd xmm15, xmm15, xmm15
+vfmadd231pd xmm15, xmm6, [rdi]
+vfmadd231pd xmm15, xmm6, [r13]
+vfmadd231pd xmm15, xmm6, [rsp+8]
+vfmadd231pd xmm15, xmm6, [r12+r9*4-200]
+vfmadd231pd xmm15, xmm6, [rbp+rcx*8]
+vfmadd231pd xmm15, xmm6, [rax*2+16]
+vfmadd231pd xmm15, xmm6, [rip+data+4]
+vfmadd231pd xmm15, xmm6, [rip+data]
+vfmadd231pd xmm15, xmm6, [rip+64]
+vfmadd231pd xmm15, xmm6, [rbx-8]
+vfmadd231pd ymm0, ymm0, ymm0
+vfmadd231pd ymm0, ymm0, ymm7
+vfmadd231pd ymm0, ymm0, ymm8
+vfmadd231pd ymm0, ymm0, ymm15
+vfmadd231pd ymm0, ymm7, ymm0
+vfmadd231pd ymm0, ymm7, ymm7
+vfmadd231pd ymm0, ymm7, ymm8
+vfmadd231pd ymm0, ymm7, ymm15
+vfmadd231pd ymm0, ymm8, ymm0
+vfmadd231pd ymm0, ymm8, ymm7
+vfmadd231pd ymm0, ymm8, ymm8
+vfmadd231pd ymm0, ymm8, ymm15
+vfmadd231pd ymm0, ymm15, ymm0
+vfmadd231pd ymm0, ymm15, ymm7
+vfmadd231pd ymm0, ymm15, ymm8
+vfmadd231pd ymm0, ymm15, ymm15
+vfmadd231pd ymm0, ymm7, [rdi]
+vfmadd231pd ymm0, ymm7, [r13]
+vfmadd231pd ymm0, ymm7, [rsp+8]
+vfmadd231pd ymm0, ymm7, [r12+r9*4-200]
+vfmadd231pd ymm0, ymm7, [rbp+rcx*8]
+vfmadd231pd ymm0, ymm7, [rax*2+16]
+vfmadd231pd ymm0, ymm7, [rip+data+4]
+vfmadd231pd ymm0, ymm7, [rip+data]
+vfmadd231pd ymm0, ymm7, [rip+64]
+vfmadd231pd ymm0, ymm7, [rbx-8]
+vfmadd231pd ymm7, ymm0, ymm0
+vfmadd231pd ymm7, ymm0, ymm7
+vfmadd231pd ymm7, ymm0, ymm8
+vfmadd231pd ymm7, ymm0, ymm15
+vfmadd231pd ymm7, ymm7, ymm0
+vfmadd231pd ymm7, ymm7, ymm7
+vfmadd231pd ymm7, ymm7, ymm8
+vfmadd231pd ymm7, ymm7, ymm15
+vfmadd231pd ymm7, ymm8, ymm0
+vfmadd231pd ymm7, ymm8, ymm7
+vfmadd231pd ymm7, ymm8, ymm8
+vfmadd231pd ymm7, ymm8, ymm15
+vfmadd231pd ymm7, ymm15, ymm0
+vfmadd231pd ymm7, ymm15, ymm7
+vfmadd231pd ymm7, ymm15, ymm8
+vfmadd231pd ymm7, ymm15, ymm15
+vfmadd231pd ymm7, ymm14, [rdi]
+vfmadd231pd ymm7, ymm14, [r13]
+vfmadd231pd ymm7, ymm14, [rsp+8]
+vfmadd231pd ymm7, ymm14, [r12+r9*4-200]
+vfmadd231pd ymm7, ymm14, [rbp+rcx*8]
+vfmadd231pd ymm7, ymm14, [rax*2+16]
+vfmadd231pd ymm7, ymm14, [rip+data+4]
+vfmadd231pd ymm7, ymm14, [rip+data]
+vfmadd231pd ymm7, ymm14, [rip+64]
+vfmadd231pd ymm7, ymm14, [rbx-8]
+vfmadd231pd ymm8, ymm0, ymm0
+vfmadd231pd ymm8, ymm0, ymm7
+vfmadd231pd ymm8, ymm0, ymm8
+vfmadd231pd ymm8, ymm0, ymm15
+vfmadd231pd ymm8, ymm7, ymm0
+vfmadd231pd ymm8, ymm7, ymm7
+vfmadd231pd ymm8, ymm7, ymm8
+vfmadd231pd ymm8, ymm7, ymm15
+vfmadd231pd ymm8, ymm8, ymm0
+vfmadd231pd ymm8, ymm8, ymm7
+vfmadd231pd ymm8, ymm8, ymm8
+vfmadd231pd ymm8, ymm8, ymm15
+vfmadd231pd ymm8, ymm15, ymm0
+vfmadd231pd ymm8, ymm15, ymm7
+vfmadd231pd ymm8, ymm15, ymm8
+vfmadd231pd ymm8, ymm15, ymm15
+vfmadd231pd ymm8, ymm15, [rdi]
+vfmadd231pd ymm8, ymm15, [r13]
+vfmadd231pd ymm8, ymm15, [rsp+8]
+vfmadd231pd ymm8, ymm15, [r12+r9*4-200]
+vfmadd231pd ymm8, ymm15, [rbp+rcx*8]
+vfmadd231pd ymm8, ymm15, [rax*2+16]
+vfmadd231pd ymm8, ymm15, [rip+data+4]
+vfmadd231pd ymm8, ymm15, [rip+data]
+vfmadd231pd ymm8, ymm15, [rip+64]
+vfmadd231pd ymm8, ymm15, [rbx-8]
+vfmadd231pd ymm15, ymm0, ymm0
+vfmadd231pd ymm15, ymm0, ymm7
+vfmadd231pd ymm15, ymm0, ymm8
+vfmadd231pd ymm15, ymm0, ymm15
+vfmadd231pd ymm15, ymm7, ymm0
+vfmadd231pd ymm15, ymm7, ymm7
+vfmadd231pd ymm15, ymm7, ymm8
+vfmadd231pd ymm15, ymm7, ymm15
+vfmadd231pd ymm15, ymm8, ymm0
+vfmadd231pd ymm15, ymm8, ymm7
+vfmadd231pd ymm15, ymm8, ymm8
+vfmadd231pd ymm15, ymm8, ymm15
+vfmadd231pd ymm15, ymm15, ymm0
+vfmadd231pd ymm15, ymm15, ymm7
+vfmadd231pd ymm15, ymm15, ymm8
+vfmadd231pd ymm15, ymm15, ymm15
+vfmadd231pd ymm15, ymm6, [rdi]
+vfmadd231pd ymm15, ymm6, [r13]
+vfmadd231pd ymm15, ymm6, [rsp+8]
+vfmadd231pd ymm15, ymm6, [r12+r9*4-200]
+vfmadd231pd ymm15, ymm6, [rbp+rcx*8]
+vfmadd231pd ymm15, ymm6, [rax*2+16]
+vfmadd231pd ymm15, ymm6, [rip+data+4]
+vfmadd231pd ymm15, ymm6, [rip+data]
+vfmadd231pd ymm15, ymm6, [rip+64]
+vfmadd231pd ymm15, ymm6, [rbx-8]
+vfmadd132pd xmm0, xmm0, xmm0
+vfmadd132pd xmm0, xmm0, xmm7
+vfmadd132pd xmm0, xmm0, xmm8
+vfmadd132pd xmm0, xmm0, xmm15
+vfmadd132pd xmm0, xmm7, xmm0
+vfmadd132pd xmm0, xmm7, xmm7
+vfmadd132pd xmm0, xmm7, xmm8
+vfmadd132pd xmm0, xmm7, xmm15
+vfmadd132pd xmm0, xmm8, xmm0
+vfmadd132pd xmm0, xmm8, xmm7
+vfmadd132pd xmm0, xmm8, xmm8
+vfmadd132pd xmm0, xmm8, xmm15
+vfmadd132pd xmm0, xmm15, xmm0
+vfmadd132pd xmm0, xmm15, xmm7
+vfmadd132pd xmm0, xmm15, xmm8
+vfmadd132pd xmm0, xmm15, xmm15
+vfmadd132pd xmm0, xmm7, [rdi]
+vfmadd132pd xmm0, xmm7, [r13]
+vfmadd132pd xmm0, xmm7, [rsp+8]
+vfmadd132pd xmm0, xmm7, [r12+r9*4-200]
+vfmadd132pd xmm0, xmm7, [rbp+rcx*8]
+vfmadd132pd xmm0, xmm7, [rax*2+16]
+vfmadd132pd xmm0, xmm7, [rip+data+4]
+vfmadd132pd xmm0, xmm7, [rip+data]
+vfmadd132pd xmm0, xmm7, [rip+64]
+vfmadd132pd xmm0, xmm7, [rbx-8]
+vfmadd132pd xmm7, xmm0, xmm0
+vfmadd132pd xmm7, xmm0, xmm7
+vfmadd132pd xmm7, xmm0, xmm8
+vfmadd132pd xmm7, xmm0, xmm15
+vfmadd132pd xmm7, xmm7, xmm0
+vfmadd132pd xmm7, xmm7, xmm7
+vfmadd132pd xmm7, xmm7, xmm8
+vfmadd132pd xmm7, xmm7, xmm15
+vfmadd132pd xmm7, xmm8, xmm0
+vfmadd132pd xmm7, xmm8, xmm7
+vfmadd132pd xmm7, xmm8, xmm8
+vfmadd132pd xmm7, xmm8, xmm15
+vfmadd132pd xmm7, xmm15, xmm0
+vfmadd132pd xmm7, xmm15, xmm7
+vfmadd132pd xmm7, xmm15, xmm8
+vfmadd132pd xmm7, xmm15, xmm15
+vfmadd132pd xmm7, xmm14, [rdi]
+vfmadd132pd xmm7, xmm14, [r13]
+vfmadd132pd xmm7, xmm14, [rsp+8]
+vfmadd132pd xmm7, xmm14, [r12+r9*4-200]
+vfmadd132pd xmm7, xmm14, [rbp+rcx*8]
+vfmadd132pd xmm7, xmm14, [rax*2+16]
+vfmadd132pd xmm7, xmm14, [rip+data+4]
+vfmadd132pd xmm7, xmm14, [rip+data]
+vfmadd132pd xmm7, xmm14, [rip+64]
+vfmadd132pd xmm7, xmm14, [rbx-8]
+vfmadd132pd xmm8, xmm0, xmm0
+vfmadd132pd xmm8, xmm0, xmm7
+vfmadd132pd xmm8, xmm0, xmm8
+vfmadd132pd xmm8, xmm0, xmm15
+vfmadd132pd xmm8, xmm7, xmm0
+vfmadd132pd xmm8, xmm7, xmm7
+vfmadd132pd xmm8, xmm7, xmm8
+vfmadd132pd xmm8, xmm7, xmm15
+vfmadd132pd xmm8, xmm8, xmm0
+vfmadd132pd xmm8, xmm8, xmm7
+vfmadd132pd xmm8, xmm8, xmm8
+vfmadd132pd xmm8, xmm8, xmm15
+vfmadd132pd xmm8, xmm15, xmm0
+vfmadd132pd xmm8, xmm15, xmm7
+vfmadd132pd xmm8, xmm15, xmm8
+vfmadd132pd xmm8, xmm15, xmm15
+vfmadd132pd xmm8, xmm15, [rdi]
+vfmadd132pd xmm8, xmm15, [r13]
+vfmadd132pd xmm8, xmm15, [rsp+8]
+vfmadd132pd xmm8, xmm15, [r12+r9*4-200]
+vfmadd132pd xmm8, xmm15, [rbp+rcx*8]
+vfmadd132pd xmm8, xmm15, [rax*2+16]
+vfmadd132pd xmm8, xmm15, [rip+data+4]
+vfmadd132pd xmm8, xmm15, [rip+data]
+vfmadd132pd xmm8, xmm15, [rip+64]
+vfmadd132pd xmm8, xmm15, [rbx-8]
+vfmadd132pd xmm15, xmm0, xmm0
+vfmadd132pd xmm15, xmm0, xmm7
+vfmadd132pd xmm15, xmm0, xmm8
+vfmadd132pd xmm15, xmm0, xmm15
+vfmadd132pd xmm15, xmm7, xmm0
+vfmadd132pd xmm15, xmm7, xmm7
+vfmadd132pd xmm15, xmm7, xmm8
+vfmadd132pd xmm15, xmm7, xmm15
+vfmadd132pd xmm15, xmm8, xmm0
+vfmadd132pd xmm15, xmm8, xmm7
+vfmadd132pd xmm15, xmm8, xmm8
+vfmadd132pd xmm15, xmm8, xmm15
+vfmadd132pd xmm15, xmm15, xmm0
+vfmadd132pd xmm15, xmm15, xmm7
+vfmadd132pd xmm15, xmm15, xmm8
+vfmadd132pd xmm15, xmm15, xmm15
+vfmadd132pd xmm15, xmm6, [rdi]
+vfmadd132pd xmm15, xmm6, [r13]
+vfmadd132pd xmm15, xmm6, [rsp+8]
+vfmadd132pd xmm15, xmm6, [r12+r9*4-200]
+vfmadd132pd xmm15, xmm6, [rbp+rcx*8]
+vfmadd132pd xmm15, xmm6, [rax*2+16]
+vfmadd132pd xmm15, xmm6, [rip+data+4]
+vfmadd132pd xmm15, xmm6, [rip+data]
+vfmadd132pd xmm15, xmm6, [rip+64]
+vfmadd132pd xmm15, xmm6, [rbx-8]
+vfmadd132pd ymm0, ymm0, ymm0
+vfmadd132pd ymm0, ymm0, ymm7
+vfmadd132pd ymm0, ymm0, ymm8
+vfmadd132pd ymm0, ymm0, ymm15
+vfmadd132pd ymm0, ymm7, ymm0
+vfmadd132pd ymm0, ymm7, ymm7
+vfmadd132pd ymm0, ymm7, ymm8
+vfmadd132pd ymm0, ymm7, ymm15
+vfmadd132pd ymm0, ymm8, ymm0
+vfmadd132pd ymm0, ymm8, ymm7
+vfmadd132pd ymm0, ymm8, ymm8
+vfmadd132pd ymm0, ymm8, ymm15
+vfmadd132pd ymm0, ymm15, ymm0
+vfmadd132pd ymm0, ymm15, ymm7
+vfmadd132pd ymm0, ymm15, ymm8
+vfmadd132pd ymm0, ymm15, ymm15
+vfmadd132pd ymm0, ymm7, [rdi]
+vfmadd132pd ymm0, ymm7, [r13]
+vfmadd132pd ymm0, ymm7, [rsp+8]
+vfmadd132pd ymm0, ymm7, [r12+r9*4-200]
+vfmadd132pd ymm0, ymm7, [rbp+rcx*8]
+vfmadd132pd ymm0, ymm7, [rax*2+16]
+vfmadd132pd ymm0, ymm7, [rip+data+4]
+vfmadd132pd ymm0, ymm7, [rip+data]
+vfmadd132pd ymm0, ymm7, [rip+64]
+vfmadd132pd ymm0, ymm7, [rbx-8]
+vfmadd132pd ymm7, ymm0, ymm0
+vfmadd132pd ymm7, ymm0, ymm7
+vfmadd132pd ymm7, ymm0, ymm8
+vfmadd132pd ymm7, ymm0, ymm15
+vfmadd132pd ymm7, ymm7, ymm0
+vfmadd132pd ymm7, ymm7, ymm7
+vfmadd132pd ymm7, ymm7, ymm8
+vfmadd132pd ymm7, ymm7, ymm15
+vfmadd132pd ymm7, ymm8, ymm0
+vfmadd132pd ymm7, ymm8, ymm7
+vfmadd132pd ymm7, ymm8, ymm8
+vfmadd132pd ymm7, ymm8, ymm15
+vfmadd132pd ymm7, ymm15, ymm0
+vfmadd132pd ymm7, ymm15, ymm7
+vfmadd132pd ymm7, ymm15, ymm8
+vfmadd132pd ymm7, ymm15, ymm15
+vfmadd132pd ymm7, ymm14, [rdi]
+vfmadd132pd ymm7, ymm14, [r13]
+vfmadd132pd ymm7, ymm14, [rsp+8]
+vfmadd132pd ymm7, ymm14, [r12+r9*4-200]
+vfmadd132pd ymm7, ymm14, [rbp+rcx*8]
+vfmadd132pd ymm7, ymm14, [rax*2+16]
+vfmadd132pd ymm7, ymm14, [rip+data+4]
+vfmadd132pd ymm7, ymm14, [rip+data]
+vfmadd132pd ymm7, ymm14, [rip+64]
+vfmadd132pd ymm7, ymm14, [rbx-8]
+vfmadd132pd ymm8, ymm0, ymm0
+vfmadd132pd ymm8, ymm0, ymm7
+vfmadd132pd ymm8, ymm0, ymm8
+vfmadd132pd ymm8, ymm0, ymm15
+vfmadd132pd ymm8, ymm7, ymm0
+vfmadd132pd ymm8, ymm7, ymm7
+vfmadd132pd ymm8, ymm7, ymm8
+vfmadd132pd ymm8, ymm7, ymm15
+vfmadd132pd ymm8, ymm8, ymm0
+vfmadd132pd ymm8, ymm8, ymm7
+vfmadd132pd ymm8, ymm8, ymm8
+vfmadd132pd ymm8, ymm8, ymm15
+vfmadd132pd ymm8, ymm15, ymm0
+vfmadd132pd ymm8, ymm15, ymm7
+vfmadd132pd ymm8, ymm15, ymm8
+vfmadd132pd ymm8, ymm15, ymm15
+vfmadd132pd ymm8, ymm15, [rdi]
+vfmadd132pd ymm8, ymm15, [r13]
+vfmadd132pd ymm8, ymm15, [rsp+8]
+vfmadd132pd ymm8, ymm15, [r12+r9*4-200]
+vfmadd132pd ymm8, ymm15, [rbp+rcx*8]
+vfmadd132pd ymm8, ymm15, [rax*2+16]
+vfmadd132pd ymm8, ymm15, [rip+data+4]
+vfmadd132pd ymm8, ymm15, [rip+data]
+vfmadd132pd ymm8, ymm15, [rip+64]
+vfmadd132pd ymm8, ymm15, [rbx-8]
+vfmadd132pd ymm15, ymm0, ymm0
+vfmadd132pd ymm15, ymm0, ymm7
+vfmadd132pd ymm15, ymm0, ymm8
+vfmadd132pd ymm15, ymm0, ymm15
+vfmadd132pd ymm15, ymm7, ymm0
+vfmadd132pd ymm15, ymm7, ymm7
+vfmadd132pd ymm15, ymm7, ymm8
+vfmadd132pd ymm15, ymm7, ymm15
+vfmadd132pd ymm15, ymm8, ymm0
+vfmadd132pd ymm15, ymm8, ymm7
+vfmadd132pd ymm15, ymm8, ymm8
+vfmadd132pd ymm15, ymm8, ymm15
+vfmadd132pd ymm15, ymm15, ymm0
+vfmadd132pd ymm15, ymm15, ymm7
+vfmadd132pd ymm15, ymm15, ymm8
+vfmadd132pd ymm15, ymm15, ymm15
+vfmadd132pd ymm15, ymm6, [rdi]
+vfmadd132pd ymm15, ymm6, [r13]
+vfmadd132pd ymm15, ymm6, [rsp+8]
+vfmadd132pd ymm15, ymm6, [r12+r9*4-200]
+vfmadd132pd ymm15, ymm6, [rbp+rcx*8]
+vfmadd132pd ymm15, ymm6, [rax*2+16]
+vfmadd132pd ymm15, ymm6, [rip+data+4]
+vfmadd132pd ymm15, ymm6, [rip+data]
+vfmadd132pd ymm15, ymm6, [rip+64]
+vfmadd132pd ymm15, ymm6, [rbx-8]
+vfmadd213pd xmm0, xmm0, xmm0
+vfmadd213pd xmm0, xmm0, xmm7
+vfmadd213pd xmm0, xmm0, xmm8
+vfmadd213pd xmm0, xmm0, xmm15
+vfmadd213pd xmm0, xmm7, xmm0
+vfmadd213pd xmm0, xmm7, xmm7
+vfmadd213pd xmm0, xmm7, xmm8
+vfmadd213pd xmm0, xmm7, xmm15
+vfmadd213pd xmm0, xmm8, xmm0
+vfmadd213pd xmm0, xmm8, xmm7
+vfmadd213pd xmm0, xmm8, xmm8
+vfmadd213pd xmm0, xmm8, xmm15
+vfmadd213pd xmm0, xmm15, xmm0
+vfmadd213pd xmm0, xmm15, xmm7
+vfmadd213pd xmm0, xmm15, xmm8
+vfmadd213pd xmm0, xmm15, xmm15
+vfmadd213pd xmm0, xmm7, [rdi]
+vfmadd213pd xmm0, xmm7, [r13]
+vfmadd213pd xmm0, xmm7, [rsp+8]
+vfmadd213pd xmm0, xmm7, [r12+r9*4-200]
+vfmadd213pd xmm0, xmm7, [rbp+rcx*8]
+vfmadd213pd xmm0, xmm7, [rax*2+16]
+vfmadd213pd xmm0, xmm7, [rip+data+4]
+vfmadd213pd xmm0, xmm7, [rip+data]
+vfmadd213pd xmm0, xmm7, [rip+64]
+vfmadd213pd xmm0, xmm7, [rbx-8]
+vfmadd213pd xmm7, xmm0, xmm0
+vfmadd213pd xmm7, xmm0, xmm7
+vfmadd213pd xmm7, xmm0, xmm8
+vfmadd213pd xmm7, xmm0, xmm15
+vfmadd213pd xmm7, xmm7, xmm0
+vfmadd213pd xmm7, xmm7, xmm7
+vfmadd213pd xmm7, xmm7, xmm8
+vfmadd213pd xmm7, xmm7, xmm15
+vfmadd213pd xmm7, xmm8, xmm0
+vfmadd213pd xmm7, xmm8, xmm7
+vfmadd213pd xmm7, xmm8, xmm8
+vfmadd213pd xmm7, xmm8, xmm15
+vfmadd213pd xmm7, xmm15, xmm0
+vfmadd213pd xmm7, xmm15, xmm7
+vfmadd213pd xmm7, xmm15, xmm8
+vfmadd213pd xmm7, xmm15, xmm15
+vfmadd213pd xmm7, xmm14, [rdi]
+vfmadd213pd xmm7, xmm14, [r13]
+vfmadd213pd xmm7, xmm14, [rsp+8]
+vfmadd213pd xmm7, xmm14, [r12+r9*4-200]
+vfmadd213pd xmm7, xmm14, [rbp+rcx*8]
+vfmadd213pd xmm7, xmm14, [rax*2+16]
+vfmadd213pd xmm7, xmm14, [rip+data+4]
+vfmadd213pd xmm7, xmm14, [rip+data]
+vfmadd213pd xmm7, xmm14, [rip+64]
+vfmadd213pd xmm7, xmm14, [rbx-8]
+vfmadd213pd xmm8, xmm0, xmm0
+vfmadd213pd xmm8, xmm0, xmm7
+vfmadd213pd xmm8, xmm0, xmm8
+vfmadd213pd xmm8, xmm0, xmm15
+vfmadd213pd xmm8, xmm7, xmm0
+vfmadd213pd xmm8, xmm7, xmm7
+vfmadd213pd xmm8, xmm7, xmm8
+vfmadd213pd xmm8, xmm7, xmm15
+vfmadd213pd xmm8, xmm8, xmm0
+vfmadd213pd xmm8, xmm8, xmm7
+vfmadd213pd xmm8, xmm8, xmm8
+vfmadd213pd xmm8, xmm8, xmm15
+vfmadd213pd xmm8, xmm15, xmm0
+vfmadd213pd xmm8, xmm15, xmm7
+vfmadd213pd xmm8, xmm15, xmm8
+vfmadd213pd xmm8, xmm15, xmm15
+vfmadd213pd xmm8, xmm15, [rdi]
+vfmadd213pd xmm8, xmm15, [r13]
+vfmadd213pd xmm8, xmm15, [rsp+8]
+vfmadd213pd xmm8, xmm15, [r12+r9*4-200]
+vfmadd213pd xmm8, xmm15, [rbp+rcx*8]
+vfmadd213pd xmm8, xmm15, [rax*2+16]
+vfmadd213pd xmm8, xmm15, [rip+data+4]
+vfmadd213pd xmm8, xmm15, [rip+data]
+vfmadd213pd xmm8, xmm15, [rip+64]
+vfmadd213pd xmm8, xmm15, [rbx-8]
+vfmadd213pd xmm15, xmm0, xmm0
+vfmadd213pd xmm15, xmm0, xmm7
+vfmadd213pd xmm15, xmm0, xmm8
+vfmadd213pd xmm15, xmm0, xmm15
+vfmadd213pd xmm15, xmm7, xmm0
+vfmadd213pd xmm15, xmm7, xmm7
+vfmadd213pd xmm15, xmm7, xmm8
+vfmadd213pd xmm15, xmm7, xmm15
+vfmadd213pd xmm15, xmm8, xmm0
+vfmadd213pd xmm15, xmm8, xmm7
+vfmadd213pd xmm15, xmm8, xmm8
+vfmadd213pd xmm15, xmm8, xmm15
+vfmadd213pd xmm15, xmm15, xmm0
+vfmadd213pd xmm15, xmm15, xmm7
+vfmadd213pd xmm15, xmm15, xmm8
+vfmadd213pd xmm15, xmm15, xmm15
+vfmadd213pd xmm15, xmm6, [rdi]
+vfmadd213pd xmm15, xmm6, [r13]
+vfmadd213pd xmm15, xmm6, [rsp+8]
+vfmadd213pd xmm15, xmm6, [r12+r9*4-200]
+vfmadd213pd xmm15, xmm6, [rbp+rcx*8]
+vfmadd213pd xmm15, xmm6, [rax*2+16]
+vfmadd213pd xmm15, xmm6, [rip+data+4]
+vfmadd213pd xmm15, xmm6, [rip+data]
+vfmadd213pd xmm15, xmm6, [rip+64]
+vfmadd213pd xmm15, xmm6, [rbx-8]
+vfmadd213pd ymm0, ymm0, ymm0
+vfmadd213pd ymm0, ymm0, ymm7
+vfmadd213pd ymm0, ymm0, ymm8
+vfmadd213pd ymm0, ymm0, ymm15
+vfmadd213pd ymm0, ymm7, ymm0
+vfmadd213pd ymm0, ymm7, ymm7
+vfmadd213pd ymm0, ymm7, ymm8
+vfmadd213pd ymm0, ymm7, ymm15
+vfmadd213pd ymm0, ymm8, ymm0
+vfmadd213pd ymm0, ymm8, ymm7
+vfmadd213pd ymm0, ymm8, ymm8
+vfmadd213pd ymm0, ymm8, ymm15
+vfmadd213pd ymm0, ymm15, ymm0
+vfmadd213pd ymm0, ymm15, ymm7
+vfmadd213pd ymm0, ymm15, ymm8
+vfmadd213pd ymm0, ymm15, ymm15
+vfmadd213pd ymm0, ymm7, [rdi]
+vfmadd213pd ymm0, ymm7, [r13]
+vfmadd213pd ymm0, ymm7, [rsp+8]
+vfmadd213pd ymm0, ymm7, [r12+r9*4-200]
+vfmadd213pd ymm0, ymm7, [rbp+rcx*8]
+vfmadd213pd ymm0, ymm7, [rax*2+16]
+vfmadd213pd ymm0, ymm7, [rip+data+4]
+vfmadd213pd ymm0, ymm7, [rip+data]
+vfmadd213pd ymm0, ymm7, [rip+64]
+vfmadd213pd ymm0, ymm7, [rbx-8]
+vfmadd213pd ymm7, ymm0, ymm0
+vfmadd213pd ymm7, ymm0, ymm7
+vfmadd213pd ymm7, ymm0, ymm8
+vfmadd213pd ymm7, ymm0, ymm15
+vfmadd213pd ymm7, ymm7, ymm0
+vfmadd213pd ymm7, ymm7, ymm7
+vfmadd213pd ymm7, ymm7, ymm8
+vfmadd213pd ymm7, ymm7, ymm15
+vfmadd213pd ymm7, ymm8, ymm0
+vfmadd213pd ymm7, ymm8, ymm7
+vfmadd213pd ymm7, ymm8, ymm8
+vfmadd213pd ymm7, ymm8, ymm15
+vfmadd213pd ymm7, ymm15, ymm0
+vfmadd213pd ymm7, ymm15, ymm7
+vfmadd213pd ymm7, ymm15, ymm8
+vfmadd213pd ymm7, ymm15, ymm15
+vfmadd213pd ymm7, ymm14, [rdi]
+vfmadd213pd ymm7, ymm14, [r13]
+vfmadd213pd ymm7, ymm14, [rsp+8]
+vfmadd213pd ymm7, ymm14, [r12+r9*4-200]
+vfmadd213pd ymm7, ymm14, [rbp+rcx*8]
+vfmadd213pd ymm7, ymm14, [rax*2+16]
+vfmadd213pd ymm7, ymm14, [rip+data+4]
+vfmadd213pd ymm7, ymm14, [rip+data]
+vfmadd213pd ymm7, ymm14, [rip+64]
+vfmadd213pd ymm7, ymm14, [rbx-8]
+vfmadd213pd ymm8, ymm0, ymm0
+vfmadd213pd ymm8, ymm0, ymm7
+vfmadd213pd ymm8, ymm0, ymm8
+vfmadd213pd ymm8, ymm0, ymm15
+vfmadd213pd ymm8, ymm7, ymm0
+vfmadd213pd ymm8, ymm7, ymm7
+vfmadd213pd ymm8, ymm7, ymm8
+vfmadd213pd ymm8, ymm7, ymm15
+vfmadd213pd ymm8, ymm8, ymm0
+vfmadd213pd ymm8, ymm8, ymm7
+vfmadd213pd ymm8, ymm8, ymm8
+vfmadd213pd ymm8, ymm8, ymm15
+vfmadd213pd ymm8, ymm15, ymm0
+vfmadd213pd ymm8, ymm15, ymm7
+vfmadd213pd ymm8, ymm15, ymm8
+vfmadd213pd ymm8, ymm15, ymm15
+vfmadd213pd ymm8, ymm15, [rdi]
+vfmadd213pd ymm8, ymm15, [r13]
+vfmadd213pd ymm8, ymm15, [rsp+8]
+vfmadd213pd ymm8, ymm15, [r12+r9*4-200]
+vfmadd213pd ymm8, ymm15, [rbp+rcx*8]
+vfmadd213pd ymm8, ymm15, [rax*2+16]
+vfmadd213pd ymm8, ymm15, [rip+data+4]
+vfmadd213pd ymm8, ymm15, [rip+data]
+vfmadd213pd ymm8, ymm15, [rip+64]
+vfmadd213pd ymm8, ymm15, [rbx-8]
+vfmadd213pd ymm15, ymm0, ymm0
+vfmadd213pd ymm15, ymm0, ymm7
+vfmadd213pd ymm15, ymm0, ymm8
+vfmadd213pd ymm15, ymm0, ymm15
+vfmadd213pd ymm15, ymm7, ymm0
+vfmadd213pd ymm15, ymm7, ymm7
+vfmadd213pd ymm15, ymm7, ymm8
+vfmadd213pd ymm15, ymm7, ymm15
+vfmadd213pd ymm15, ymm8, ymm0
+vfmadd213pd ymm15, ymm8, ymm7
+vfmadd213pd ymm15, ymm8, ymm8
+vfmadd213pd ymm15, ymm8, ymm15
+vfmadd213pd ymm15, ymm15, ymm0
+vfmadd213pd ymm15, ymm15, ymm7
+vfmadd213pd ymm15, ymm15, ymm8
+vfmadd213pd ymm15, ymm15, ymm15
+vfmadd213pd ymm15, ymm6, [rdi]
+vfmadd213pd ymm15, ymm6, [r13]
+vfmadd213pd ymm15, ymm6, [rsp+8]
+vfmadd213pd ymm15, ymm6, [r12+r9*4-200]
+vfmadd213pd ymm15, ymm6, [rbp+rcx*8]
+vfmadd213pd ymm15, ymm6, [rax*2+16]
+vfmadd213pd ymm15, ymm6, [rip+data+4]
+vfmadd213pd ymm15, ymm6, [rip+data]
+vfmadd213pd ymm15, ymm6, [rip+64]
+vfmadd213pd ymm15, ymm6, [rbx-8]
+pmovmskb eax, xmm0
+pmovmskb eax, xmm7
+pmovmskb eax, xmm8
+pmovmskb eax, xmm15
+pmovmskb edi, xmm0
+pmovmskb edi, xmm7
+pmovmskb edi, xmm8
+pmovmskb edi, xmm15
+pmovmskb r8d, xmm0
+pmovmskb r8d, xmm7
+pmovmskb r8d, xmm8
+pmovmskb r8d, xmm15
+pmovmskb r15d, xmm0
+pmovmskb r15d, xmm7
+pmovmskb r15d, xmm8
+pmovmskb r15d, xmm15
+vpmovmskb eax, xmm0
+vpmovmskb eax, xmm7
+vpmovmskb eax, xmm8
+vpmovmskb eax, xmm15
+vpmovmskb edi, xmm0
+vpmovmskb edi, xmm7
+vpmovmskb edi, xmm8
+vpmovmskb edi, xmm15
+vpmovmskb r8d, xmm0
+vpmovmskb r8d, xmm7
+vpmovmskb r8d, xmm8
+vpmovmskb r8d, xmm15
+vpmovmskb r15d, xmm0
+vpmovmskb r15d, xmm7
+vpmovmskb r15d, xmm8
+vpmovmskb r15d, xmm15
+vpmovmskb eax, ymm0
+vpmovmskb eax, ymm7
+vpmovmskb eax, ymm8
+vpmovmskb eax, ymm15
+vpmovmskb edi, ymm0
+vpmovmskb edi, ymm7
+vpmovmskb edi, ymm8
+vpmovmskb edi, ymm15
+vpmovmskb r8d, ymm0
+vpmovmskb r8d, ymm7
+vpmovmskb r8d, ymm8
+vpmovmskb r8d, ymm15
+vpmovmskb r15d, ymm0
+vpmovmskb r15d, ymm7
+vpmovmskb r15d, ymm8
+vpmovmskb r15d, ymm15
+vbroadcastss xmm0, xmm0
+vbroadcastss xmm0, xmm7
+vbroadcastss xmm0, xmm8
+vbroadcastss xmm0, xmm15
+vbroadcastss xmm0, [rdi]
+vbroadcastss xmm0, [r13]
+vbroadcastss xmm0, [rsp+8]
+vbroadcastss xmm0, [r12+r9*4-200]
+vbroadcastss xmm0, [rbp+rcx*8]
+vbroadcastss xmm0, [rax*2+16]
+vbroadcastss xmm0, [rip+data+4]
+vbroadcastss xmm0, [rip+data]
+vbroadcastss xmm0, [rip+64]
+vbroadcastss xmm0, [rbx-8]
+vbroadcastss xmm7, xmm0
+vbroadcastss xmm7, xmm7
+vbroadcastss xmm7, xmm8
+vbroadcastss xmm7, xmm15
+vbroadcastss xmm7, [rdi]
+vbroadcastss xmm7, [r13]
+vbroadcastss xmm7, [rsp+8]
+vbroadcastss xmm7, [r12+r9*4-200]
+vbroadcastss xmm7, [rbp+rcx*8]
+vbroadcastss xmm7, [rax*2+16]
+vbroadcastss xmm7, [rip+data+4]
+vbroadcastss xmm7, [rip+data]
+vbroadcastss xmm7, [rip+64]
+vbroadcastss xmm7, [rbx-8]
+vbroadcastss xmm8, xmm0
+vbroadcastss xmm8, xmm7
+vbroadcastss xmm8, xmm8
+vbroadcastss xmm8, xmm15
+vbroadcastss xmm8, [rdi]
+vbroadcastss xmm8, [r13]
+vbroadcastss xmm8, [rsp+8]
+vbroadcastss xmm8, [r12+r9*4-200]
+vbroadcastss xmm8, [rbp+rcx*8]
+vbroadcastss xmm8, [rax*2+16]
+vbroadcastss xmm8, [rip+data+4]
+vbroadcastss xmm8, [rip+data]
+vbroadcastss xmm8, [rip+64]
+vbroadcastss xmm8, [rbx-8]
+vbroadcastss xmm15, xmm0
+vbroadcastss xmm15, xmm7
+vbroadcastss xmm15, xmm8
+vbroadcastss xmm15, xmm15
+vbroadcastss xmm15, [rdi]
+vbroadcastss xmm15, [r13]
+vbroadcastss xmm15, [rsp+8]
+vbroadcastss xmm15, [r12+r9*4-200]
+vbroadcastss xmm15, [rbp+rcx*8]
+vbroadcastss xmm15, [rax*2+16]
+vbroadcastss xmm15, [rip+data+4]
+vbroadcastss xmm15, [rip+data]
+vbroadcastss xmm15, [rip+64]
+vbroadcastss xmm15, [rbx-8]
+vbroadcastss ymm0, xmm0
+vbroadcastss ymm0, xmm7
+vbroadcastss ymm0, xmm8
+vbroadcastss ymm0, xmm15
+vbroadcastss ymm0, [rdi]
+vbroadcastss ymm0, [r13]
+vbroadcastss ymm0, [rsp+8]
+vbroadcastss ymm0, [r12+r9*4-200]
+vbroadcastss ymm0, [rbp+rcx*8]
+vbroadcastss ymm0, [rax*2+16]
+vbroadcastss ymm0, [rip+data+4]
+vbroadcastss ymm0, [rip+data]
+vbroadcastss ymm0, [rip+64]
+vbroadcastss ymm0, [rbx-8]
+vbroadcastss ymm7, xmm0
+vbroadcastss ymm7, xmm7
+vbroadcastss ymm7, xmm8
+vbroadcastss ymm7, xmm15
+vbroadcastss ymm7, [rdi]
+vbroadcastss ymm7, [r13]
+vbroadcastss ymm7, [rsp+8]
+vbroadcastss ymm7, [r12+r9*4-200]
+vbroadcastss ymm7, [rbp+rcx*8]
+vbroadcastss ymm7, [rax*2+16]
+vbroadcastss ymm7, [rip+data+4]
+vbroadcastss ymm7, [rip+data]
+vbroadcastss ymm7, [rip+64]
+vbroadcastss ymm7, [rbx-8]
+vbroadcastss ymm8, xmm0
+vbroadcastss ymm8, xmm7
+vbroadcastss ymm8, xmm8
+vbroadcastss ymm8, xmm15
+vbroadcastss ymm8, [rdi]
+vbroadcastss ymm8, [r13]
+vbroadcastss ymm8, [rsp+8]
+vbroadcastss ymm8, [r12+r9*4-200]
+vbroadcastss ymm8, [rbp+rcx*8]
+vbroadcastss ymm8, [rax*2+16]
+vbroadcastss ymm8, [rip+data+4]
+vbroadcastss ymm8, [rip+data]
+vbroadcastss ymm8, [rip+64]
+vbroadcastss ymm8, [rbx-8]
+vbroadcastss ymm15, xmm0
+vbroadcastss ymm15, xmm7
+vbroadcastss ymm15, xmm8
+vbroadcastss ymm15, xmm15
+vbroadcastss ymm15, [rdi]
+vbroadcastss ymm15, [r13]
+vbroadcastss ymm15, [rsp+8]
+vbroadcastss ymm15, [r12+r9*4-200]
+vbroadcastss ymm15, [rbp+rcx*8]
+vbroadcastss ymm15, [rax*2+16]
+vbroadcastss ymm15, [rip+data+4]
+vbroadcastss ymm15, [rip+data]
+vbroadcastss ymm15, [rip+64]
+vbroadcastss ymm15, [rbx-8]
+vbroadcastsd ymm0, xmm0
+vbroadcastsd ymm0, xmm7
+vbroadcastsd ymm0, xmm8
+vbroadcastsd ymm0, xmm15
+vbroadcastsd ymm0, [rdi]
+vbroadcastsd ymm0, [r13]
+vbroadcastsd ymm0, [rsp+8]
+vbroadcastsd ymm0, [r12+r9*4-200]
+vbroadcastsd ymm0, [rbp+rcx*8]
+vbroadcastsd ymm0, [rax*2+16]
+vbroadcastsd ymm0, [rip+data+4]
+vbroadcastsd ymm0, [rip+data]
+vbroadcastsd ymm0, [rip+64]
+vbroadcastsd ymm0, [rbx-8]
+vbroadcastsd ymm7, xmm0
+vbroadcastsd ymm7, xmm7
+vbroadcastsd ymm7, xmm8
+vbroadcastsd ymm7, xmm15
+vbroadcastsd ymm7, [rdi]
+vbroadcastsd ymm7, [r13]
+vbroadcastsd ymm7, [rsp+8]
+vbroadcastsd ymm7, [r12+r9*4-200]
+vbroadcastsd ymm7, [rbp+rcx*8]
+vbroadcastsd ymm7, [rax*2+16]
+vbroadcastsd ymm7, [rip+data+4]
+vbroadcastsd ymm7, [rip+data]
+vbroadcastsd ymm7, [rip+64]
+vbroadcastsd ymm7, [rbx-8]
+vbroadcastsd ymm8, xmm0
+vbroadcastsd ymm8, xmm7
+vbroadcastsd ymm8, xmm8
+vbroadcastsd ymm8, xmm15
+vbroadcastsd ymm8, [rdi]
+vbroadcastsd ymm8, [r13]
+vbroadcastsd ymm8, [rsp+8]
+vbroadcastsd ymm8, [r12+r9*4-200]
+vbroadcastsd ymm8, [rbp+rcx*8]
+vbroadcastsd ymm8, [rax*2+16]
+vbroadcastsd ymm8, [rip+data+4]
+vbroadcastsd ymm8, [rip+data]
+vbroadcastsd ymm8, [rip+64]
+vbroadcastsd ymm8, [rbx-8]
+vbroadcastsd ymm15, xmm0
+vbroadcastsd ymm15, xmm7
+vbroadcastsd ymm15, xmm8
+vbroadcastsd ymm15, xmm15
+vbroadcastsd ymm15, [rdi]
+vbroadcastsd ymm15, [r13]
+vbroadcastsd ymm15, [rsp+8]
+vbroadcastsd ymm15, [r12+r9*4-200]
+vbroadcastsd ymm15, [rbp+rcx*8]
+vbroadcastsd ymm15, [rax*2+16]
+vbroadcastsd ymm15, [rip+data+4]
+vbroadcastsd ymm15, [rip+data]
+vbroadcastsd ymm15, [rip+64]
+vbroadcastsd ymm15, [rbx-8]
+vpbroadcastd xmm0, xmm0
+vpbroadcastd xmm0, xmm7
+vpbroadcastd xmm0, xmm8
+vpbroadcastd xmm0, xmm15
+vpbroadcastd xmm0, [rdi]
+vpbroadcastd xmm0, [r13]
+vpbroadcastd xmm0, [rsp+8]
+vpbroadcastd xmm0, [r12+r9*4-200]
+vpbroadcastd xmm0, [rbp+rcx*8]
+vpbroadcastd xmm0, [rax*2+16]
+vpbroadcastd xmm0, [rip+data+4]
+vpbroadcastd xmm0, [rip+data]
+vpbroadcastd xmm0, [rip+64]
+vpbroadcastd xmm0, [rbx-8]
+vpbroadcastd xmm7, xmm0
+vpbroadcastd xmm7, xmm7
+vpbroadcastd xmm7, xmm8
+vpbroadcastd xmm7, xmm15
+vpbroadcastd xmm7, [rdi]
+vpbroadcastd xmm7, [r13]
+vpbroadcastd xmm7, [rsp+8]
+vpbroadcastd xmm7, [r12+r9*4-200]
+vpbroadcastd xmm7, [rbp+rcx*8]
+vpbroadcastd xmm7, [rax*2+16]
+vpbroadcastd xmm7, [rip+data+4]
+vpbroadcastd xmm7, [rip+data]
+vpbroadcastd xmm7, [rip+64]
+vpbroadcastd xmm7, [rbx-8]
+vpbroadcastd xmm8, xmm0
+vpbroadcastd xmm8, xmm7
+vpbroadcastd xmm8, xmm8
+vpbroadcastd xmm8, xmm15
+vpbroadcastd xmm8, [rdi]
+vpbroadcastd xmm8, [r13]
+vpbroadcastd xmm8, [rsp+8]
+vpbroadcastd xmm8, [r12+r9*4-200]
+vpbroadcastd xmm8, [rbp+rcx*8]
+vpbroadcastd xmm8, [rax*2+16]
+vpbroadcastd xmm8, [rip+data+4]
+vpbroadcastd xmm8, [rip+data]
+vpbroadcastd xmm8, [rip+64]
+vpbroadcastd xmm8, [rbx-8]
+vpbroadcastd xmm15, xmm0
+vpbroadcastd xmm15, xmm7
+vpbroadcastd xmm15, xmm8
+vpbroadcastd xmm15, xmm15
+vpbroadcastd xmm15, [rdi]
+vpbroadcastd xmm15, [r13]
+vpbroadcastd xmm15, [rsp+8]
+vpbroadcastd xmm15, [r12+r9*4-200]
+vpbroadcastd xmm15, [rbp+rcx*8]
+vpbroadcastd xmm15, [rax*2+16]
+vpbroadcastd xmm15, [rip+data+4]
+vpbroadcastd xmm15, [rip+data]
+vpbroadcastd xmm15, [rip+64]
+vpbroadcastd xmm15, [rbx-8]
+vpbroadcastd ymm0, xmm0
+vpbroadcastd ymm0, xmm7
+vpbroadcastd ymm0, xmm8
+vpbroadcastd ymm0, xmm15
+vpbroadcastd ymm0, [rdi]
+vpbroadcastd ymm0, [r13]
+vpbroadcastd ymm0, [rsp+8]
+vpbroadcastd ymm0, [r12+r9*4-200]
+vpbroadcastd ymm0, [rbp+rcx*8]
+vpbroadcastd ymm0, [rax*2+16]
+vpbroadcastd ymm0, [rip+data+4]
+vpbroadcastd ymm0, [rip+data]
+vpbroadcastd ymm0, [rip+64]
+vpbroadcastd ymm0, [rbx-8]
+vpbroadcastd ymm7, xmm0
+vpbroadcastd ymm7, xmm7
+vpbroadcastd ymm7, xmm8
+vpbroadcastd ymm7, xmm15
+vpbroadcastd ymm7, [rdi]
+vpbroadcastd ymm7, [r13]
+vpbroadcastd ymm7, [rsp+8]
+vpbroadcastd ymm7, [r12+r9*4-200]
+vpbroadcastd ymm7, [rbp+rcx*8]
+vpbroadcastd ymm7, [rax*2+16]
+vpbroadcastd ymm7, [rip+data+4]
+vpbroadcastd ymm7, [rip+data]
+vpbroadcastd ymm7, [rip+64]
+vpbroadcastd ymm7, [rbx-8]
+vpbroadcastd ymm8, xmm0
+vpbroadcastd ymm8, xmm7
+vpbroadcastd ymm8, xmm8
+vpbroadcastd ymm8, xmm15
+vpbroadcastd ymm8, [rdi]
+vpbroadcastd ymm8, [r13]
+vpbroadcastd ymm8, [rsp+8]
+vpbroadcastd ymm8, [r12+r9*4-200]
+vpbroadcastd ymm8, [rbp+rcx*8]
+vpbroadcastd ymm8, [rax*2+16]
+vpbroadcastd ymm8, [rip+data+4]
+vpbroadcastd ymm8, [rip+data]
+vpbroadcastd ymm8, [rip+64]
+vpbroadcastd ymm8, [rbx-8]
+vpbroadcastd ymm15, xmm0
+vpbroadcastd ymm15, xmm7
+vpbroadcastd ymm15, xmm8
+vpbroadcastd ymm15, xmm15
+vpbroadcastd ymm15, [rdi]
+vpbroadcastd ymm15, [r13]
+vpbroadcastd ymm15, [rsp+8]
+vpbroadcastd ymm15, [r12+r9*4-200]
+vpbroadcastd ymm15, [rbp+rcx*8]
+vpbroadcastd ymm15, [rax*2+16]
+vpbroadcastd ymm15, [rip+data+4]
+vpbroadcastd ymm15, [rip+data]
+vpbroadcastd ymm15, [rip+64]
+vpbroadcastd ymm15, [rbx-8]
+mov rax, [rdi]
+ret
+data: